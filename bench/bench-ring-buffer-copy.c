@@ -0,0 +1,69 @@
+/*!
+ * \file bench-ring-buffer-copy.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Single thread benchmark of the copy kernels specialized for the item
+ *      size against the generic memcpy
+ *
+ * \details For each item size BENCH_ITEMS items are pushed and popped one at
+ *      a time, first with the kernel chosen during the initialization and then
+ *      with the generic copy function, and the average time per push and pop
+ *      pair is printed.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "ring-buffer-api.h"
+
+#ifndef BENCH_ITEMS
+#define BENCH_ITEMS (20000000U)
+#endif // BENCH_ITEMS
+#ifndef BENCH_CAPACITY
+#define BENCH_CAPACITY (64U)
+#endif // BENCH_CAPACITY
+
+static double elapsed_ns(const struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double)(end.tv_sec - start->tv_sec) * 1e9 + (double)(end.tv_nsec - start->tv_nsec);
+}
+
+static double bench(RingBufferHandler_t *buffer) {
+    uint8_t item[64] = { 0 }, out[64];
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < BENCH_ITEMS; ++i) {
+        item[0] = (uint8_t)i;
+        ring_buffer_api_push_back(buffer, item);
+        ring_buffer_api_pop_front(buffer, out);
+    }
+    return elapsed_ns(&start) / BENCH_ITEMS;
+}
+
+int main(void) {
+    static const size_t sizes[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+    ArenaAllocatorHandler_t arena;
+    arena_allocator_api_init(&arena);
+
+    printf("item size    kernel     memcpy\n");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        RingBufferHandler_t buffer;
+        ring_buffer_api_init(&buffer, sizes[i], BENCH_CAPACITY, NULL, NULL, &arena);
+        const double kernel = bench(&buffer);
+        buffer.copy = ring_buffer_api_copy_generic;
+        const double generic = bench(&buffer);
+        printf("%9zu %6.2f ns  %6.2f ns\n", sizes[i], kernel, generic);
+    }
+
+    arena_allocator_api_free(&arena);
+    return 0;
+}
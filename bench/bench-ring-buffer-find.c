@@ -0,0 +1,110 @@
+/*!
+ * \file bench-ring-buffer-find.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Single thread benchmark of the delimiter based reads against a loop
+ *      that pops one byte at a time
+ *
+ * \details Frames of BENCH_FRAME_SIZE bytes ended by 0x7E are written in a
+ *      byte-stream buffer and read back with:
+ *      - ring_buffer_api_pop_front and a compare for every byte
+ *      - ring_buffer_api_read_until
+ *      - ring_buffer_api_acquire_until and ring_buffer_api_release_front
+ *      For each reader the average time per frame is printed.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ring-buffer-api.h"
+
+#ifndef BENCH_FRAMES
+#define BENCH_FRAMES (2000000U)
+#endif // BENCH_FRAMES
+#ifndef BENCH_FRAME_SIZE
+#define BENCH_FRAME_SIZE (64U)
+#endif // BENCH_FRAME_SIZE
+#ifndef BENCH_CAPACITY
+#define BENCH_CAPACITY (1000U)
+#endif // BENCH_CAPACITY
+
+#define BENCH_DELIMITER (0x7EU)
+
+typedef enum {
+    READER_POP,
+    READER_READ_UNTIL,
+    READER_ACQUIRE_UNTIL
+} ReaderType;
+
+static double elapsed_ns(const struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double)(end.tv_sec - start->tv_sec) * 1e9 + (double)(end.tv_nsec - start->tv_nsec);
+}
+
+static size_t read_frame(RingBufferHandler_t *buffer, ReaderType type, uint8_t *frame) {
+    size_t n = 0U;
+    switch (type) {
+        case READER_POP:
+            while (ring_buffer_api_pop_front(buffer, frame + n) == RING_BUFFER_OK)
+                if (frame[n++] == BENCH_DELIMITER)
+                    break;
+            break;
+        case READER_READ_UNTIL:
+            n = ring_buffer_api_read_until(buffer, BENCH_DELIMITER, frame, BENCH_FRAME_SIZE);
+            break;
+        case READER_ACQUIRE_UNTIL: {
+            void *seg1, *seg2;
+            size_t len1, len2;
+            if (ring_buffer_api_acquire_until(buffer, BENCH_DELIMITER, &seg1, &len1, &seg2, &len2) == RING_BUFFER_OK) {
+                // Only the last byte is checked, the frame is processed in place
+                n = len1 + len2;
+                frame[0] = len2 > 0U ? ((uint8_t *)seg2)[len2 - 1U] : ((uint8_t *)seg1)[len1 - 1U];
+                ring_buffer_api_release_front(buffer, n);
+            }
+            break;
+        }
+    }
+    return n;
+}
+
+static void bench(const char *name, ReaderType type, ArenaAllocatorHandler_t *arena) {
+    uint8_t frame[BENCH_FRAME_SIZE], out[BENCH_FRAME_SIZE];
+    memset(frame, 0x55, sizeof(frame));
+    frame[BENCH_FRAME_SIZE - 1U] = BENCH_DELIMITER;
+
+    RingBufferHandler_t buffer;
+    ring_buffer_api_init(&buffer, sizeof(uint8_t), BENCH_CAPACITY, NULL, NULL, arena);
+
+    size_t total = 0U;
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < BENCH_FRAMES; ++i) {
+        ring_buffer_api_write(&buffer, frame, sizeof(frame));
+        total += read_frame(&buffer, type, out);
+    }
+    const double ns = elapsed_ns(&start);
+    if (total != (size_t)BENCH_FRAMES * BENCH_FRAME_SIZE)
+        printf("%-14s read %zu bytes instead of %zu\n", name, total, (size_t)BENCH_FRAMES * BENCH_FRAME_SIZE);
+    printf("%-14s %8.2f ns/frame\n", name, ns / BENCH_FRAMES);
+}
+
+int main(void) {
+    ArenaAllocatorHandler_t arena;
+    arena_allocator_api_init(&arena);
+
+    bench("pop per byte", READER_POP, &arena);
+    bench("read until", READER_READ_UNTIL, &arena);
+    bench("acquire until", READER_ACQUIRE_UNTIL, &arena);
+
+    arena_allocator_api_free(&arena);
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*!
+ * \file bench-ring-buffer-inline.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Single thread benchmark of the call overhead of the push and pop
+ *      functions for 4 bytes items
+ *
+ * \details BENCH_ITEMS items are pushed and popped one at a time and the
+ *      average time per push and pop pair is printed for:
+ *      - the ring_buffer_api functions with the dummy critical section
+ *      - the inline functions without critical section and with a constant
+ *        item size
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#define RING_BUFFER_INLINE_NO_LOCK
+#define RING_BUFFER_INLINE_DATA_SIZE(buffer) sizeof(uint32_t)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "ring-buffer-inline.h"
+
+#ifndef BENCH_ITEMS
+#define BENCH_ITEMS (100000000U)
+#endif // BENCH_ITEMS
+#ifndef BENCH_CAPACITY
+#define BENCH_CAPACITY (64U)
+#endif // BENCH_CAPACITY
+
+static double elapsed_ns(const struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double)(end.tv_sec - start->tv_sec) * 1e9 + (double)(end.tv_nsec - start->tv_nsec);
+}
+
+static void bench_api(RingBufferHandler_t *buffer) {
+    struct timespec start;
+    uint32_t sum = 0U;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < BENCH_ITEMS; ++i) {
+        uint32_t out = 0U;
+        ring_buffer_api_push_back(buffer, &i);
+        ring_buffer_api_pop_front(buffer, &out);
+        sum += out;
+    }
+    printf("%-24s %6.2f ns/item (checksum %u)\n", "ring_buffer_api:", elapsed_ns(&start) / BENCH_ITEMS, sum);
+}
+
+static void bench_inline(RingBufferHandler_t *buffer) {
+    struct timespec start;
+    uint32_t sum = 0U;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < BENCH_ITEMS; ++i) {
+        uint32_t out = 0U;
+        ring_buffer_inline_push_back(buffer, &i);
+        ring_buffer_inline_pop_front(buffer, &out);
+        sum += out;
+    }
+    printf("%-24s %6.2f ns/item (checksum %u)\n", "ring_buffer_inline:", elapsed_ns(&start) / BENCH_ITEMS, sum);
+}
+
+int main(void) {
+    ArenaAllocatorHandler_t arena;
+    arena_allocator_api_init(&arena);
+
+    RingBufferHandler_t buffer;
+    ring_buffer_api_init(&buffer, sizeof(uint32_t), BENCH_CAPACITY, NULL, NULL, &arena);
+    bench_api(&buffer);
+    bench_inline(&buffer);
+
+    arena_allocator_api_free(&arena);
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*!
+ * \file bench-ring-buffer-lock.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Contention benchmark of the lock policies of the ring buffer
+ *
+ * \details BENCH_THREADS threads push and pop BENCH_ITEMS items each, first
+ *      every thread on its own buffer and then all the threads on the same
+ *      buffer. The total number of operations per second is printed for:
+ *      - a single mutex shared by all the buffers through cs_enter and cs_exit
+ *      - a pthread mutex per buffer
+ *      - a spinlock per buffer
+ *      - a ticket lock per buffer
+ *      With one buffer per thread only the shared mutex has contention, the
+ *      benchmark must be run on a machine with at least BENCH_THREADS cores
+ *      to be meaningful.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "ring-buffer-lock-api.h"
+
+#ifndef BENCH_THREADS
+#define BENCH_THREADS (8U)
+#endif // BENCH_THREADS
+#ifndef BENCH_ITEMS
+#define BENCH_ITEMS (1000000U)
+#endif // BENCH_ITEMS
+#ifndef BENCH_CAPACITY
+#define BENCH_CAPACITY (64U)
+#endif // BENCH_CAPACITY
+
+typedef enum {
+    LOCK_GLOBAL_MUTEX,
+    LOCK_MUTEX,
+    LOCK_SPINLOCK,
+    LOCK_TICKET
+} LockType;
+
+typedef struct {
+    RingBufferHandler_t buffer;
+    pthread_mutex_t mutex;
+    RingBufferSpinlock_t spinlock;
+    RingBufferTicketLock_t ticket;
+} __attribute__((aligned(64))) BenchRing;
+
+static pthread_mutex_t global_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void cs_enter(void) {
+    pthread_mutex_lock(&global_mutex);
+}
+
+static void cs_exit(void) {
+    pthread_mutex_unlock(&global_mutex);
+}
+
+static double elapsed_s(const struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double)(end.tv_sec - start->tv_sec) + (double)(end.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+static void *worker(void *arg) {
+    RingBufferHandler_t *buffer = (RingBufferHandler_t *)arg;
+    for (uint32_t i = 0; i < BENCH_ITEMS; ++i) {
+        uint32_t val = i;
+        while (ring_buffer_api_push_back(buffer, &val) != RING_BUFFER_OK)
+            sched_yield();
+        while (ring_buffer_api_pop_front(buffer, &val) != RING_BUFFER_OK)
+            sched_yield();
+    }
+    return NULL;
+}
+
+static void ring_init(BenchRing *ring, LockType type, ArenaAllocatorHandler_t *arena) {
+    ring_buffer_api_init(&ring->buffer, sizeof(uint32_t), BENCH_CAPACITY, cs_enter, cs_exit, arena);
+    pthread_mutex_init(&ring->mutex, NULL);
+    ring_buffer_lock_api_spinlock_init(&ring->spinlock);
+    ring_buffer_lock_api_ticket_init(&ring->ticket);
+    if (type == LOCK_MUTEX)
+        ring_buffer_api_set_lock(&ring->buffer, &ring_buffer_lock_pthread_mutex, &ring->mutex);
+    else if (type == LOCK_SPINLOCK)
+        ring_buffer_api_set_lock(&ring->buffer, &ring_buffer_lock_spinlock, &ring->spinlock);
+    else if (type == LOCK_TICKET)
+        ring_buffer_api_set_lock(&ring->buffer, &ring_buffer_lock_ticket, &ring->ticket);
+}
+
+static double bench(LockType type, bool shared, ArenaAllocatorHandler_t *arena) {
+    static BenchRing rings[BENCH_THREADS];
+    for (uint32_t t = 0; t < BENCH_THREADS; ++t)
+        ring_init(&rings[t], type, arena);
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_t threads[BENCH_THREADS];
+    for (uint32_t t = 0; t < BENCH_THREADS; ++t)
+        pthread_create(&threads[t], NULL, worker, &rings[shared ? 0U : t].buffer);
+    for (uint32_t t = 0; t < BENCH_THREADS; ++t)
+        pthread_join(threads[t], NULL);
+    const double ops = 2.0 * BENCH_THREADS * BENCH_ITEMS / elapsed_s(&start);
+
+    for (uint32_t t = 0; t < BENCH_THREADS; ++t)
+        pthread_mutex_destroy(&rings[t].mutex);
+    return ops;
+}
+
+int main(void) {
+    static const char *names[] = { "global mutex", "mutex per buffer", "spinlock", "ticket lock" };
+
+    ArenaAllocatorHandler_t arena;
+    arena_allocator_api_init(&arena);
+
+    printf("%u threads           separate buffers  shared buffer\n", BENCH_THREADS);
+    for (LockType type = LOCK_GLOBAL_MUTEX; type <= LOCK_TICKET; ++type) {
+        const double separate = bench(type, false, &arena);
+        const double shared = bench(type, true, &arena);
+        printf("%-20s %10.2f Mops/s %8.2f Mops/s\n", names[type], separate * 1e-6, shared * 1e-6);
+    }
+
+    arena_allocator_api_free(&arena);
+    return 0;
+}
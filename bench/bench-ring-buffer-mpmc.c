@@ -0,0 +1,139 @@
+/*!
+ * \file bench-ring-buffer-mpmc.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Throughput benchmark of the lock-free multi-producer/multi-consumer
+ *      ring buffer against the standard ring buffer protected by a mutex
+ *
+ * \details For every thread count from 1 to the value given as the first
+ *      argument (4 by default) the same number of producer and consumer
+ *      threads is started and the number of items transferred per second
+ *      is printed for both implementations.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ring-buffer-api.h"
+#include "ring-buffer-mpmc-api.h"
+
+#ifndef BENCH_ITEMS
+#define BENCH_ITEMS (4000000U)
+#endif // BENCH_ITEMS
+#ifndef BENCH_CAPACITY
+#define BENCH_CAPACITY (1024U)
+#endif // BENCH_CAPACITY
+#define BENCH_MAX_THREADS (64U)
+
+typedef struct {
+    void *buffer;
+    RingBufferReturnCode (*push)(void *buffer, const void *item);
+    RingBufferReturnCode (*pop)(void *buffer, void *out);
+    size_t items;
+    size_t total;
+    atomic_size_t *received;
+} BenchArgs;
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void cs_enter(void) {
+    pthread_mutex_lock(&mutex);
+}
+
+static void cs_exit(void) {
+    pthread_mutex_unlock(&mutex);
+}
+
+static RingBufferReturnCode mutex_push(void *buffer, const void *item) {
+    return ring_buffer_api_push_back(buffer, (void *)item);
+}
+
+static RingBufferReturnCode mutex_pop(void *buffer, void *out) {
+    return ring_buffer_api_pop_front(buffer, out);
+}
+
+static RingBufferReturnCode mpmc_push(void *buffer, const void *item) {
+    return ring_buffer_mpmc_api_push_back(buffer, item);
+}
+
+static RingBufferReturnCode mpmc_pop(void *buffer, void *out) {
+    return ring_buffer_mpmc_api_pop_front(buffer, out);
+}
+
+static void *producer(void *arg) {
+    BenchArgs *args = (BenchArgs *)arg;
+    for (uint32_t i = 0; i < args->items; ++i) {
+        while (args->push(args->buffer, &i) != RING_BUFFER_OK)
+            sched_yield();
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg) {
+    BenchArgs *args = (BenchArgs *)arg;
+    uint32_t val;
+    while (atomic_load_explicit(args->received, memory_order_relaxed) < args->total) {
+        if (args->pop(args->buffer, &val) == RING_BUFFER_OK)
+            atomic_fetch_add_explicit(args->received, 1U, memory_order_relaxed);
+        else
+            sched_yield();
+    }
+    return NULL;
+}
+
+static double run(BenchArgs *args, size_t threads) {
+    pthread_t producers[BENCH_MAX_THREADS];
+    pthread_t consumers[BENCH_MAX_THREADS];
+    atomic_size_t received = 0U;
+    args->items = BENCH_ITEMS / threads;
+    args->total = args->items * threads;
+    args->received = &received;
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_create(&producers[i], NULL, producer, args);
+        pthread_create(&consumers[i], NULL, consumer, args);
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    const double elapsed = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) * 1e-9;
+    return (double)args->total / elapsed;
+}
+
+int main(int argc, char **argv) {
+    size_t max_threads = argc > 1 ? strtoul(argv[1], NULL, 10) : 4U;
+    if (max_threads == 0U || max_threads > BENCH_MAX_THREADS)
+        max_threads = 4U;
+
+    ArenaAllocatorHandler_t arena;
+    arena_allocator_api_init(&arena);
+
+    printf("threads  mutex [Mitems/s]  mpmc [Mitems/s]\n");
+    for (size_t threads = 1; threads <= max_threads; ++threads) {
+        RingBufferHandler_t mutex_buf;
+        RingBufferMpmcHandler_t mpmc_buf;
+        ring_buffer_api_init(&mutex_buf, sizeof(uint32_t), BENCH_CAPACITY, cs_enter, cs_exit, &arena);
+        ring_buffer_mpmc_api_init(&mpmc_buf, sizeof(uint32_t), BENCH_CAPACITY, &arena);
+
+        BenchArgs mutex_args = { .buffer = &mutex_buf, .push = mutex_push, .pop = mutex_pop };
+        BenchArgs mpmc_args = { .buffer = &mpmc_buf, .push = mpmc_push, .pop = mpmc_pop };
+        const double mutex_rate = run(&mutex_args, threads);
+        const double mpmc_rate = run(&mpmc_args, threads);
+        printf("%7zu  %16.2f  %15.2f\n", threads, mutex_rate * 1e-6, mpmc_rate * 1e-6);
+    }
+
+    arena_allocator_api_free(&arena);
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*!
+ * \file bench-ring-buffer-shm.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Throughput benchmark of the shared memory ring buffer against a pipe
+ *      between two processes
+ *
+ * \details A child process produces batches of fixed size records which are
+ *      consumed by the parent process, first through a pipe (one write and
+ *      one read system call per batch) and then through the shared memory
+ *      ring buffer (no system calls), the number of records transferred per
+ *      second is printed for both.
+ */
+
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ring-buffer-shm-api.h"
+
+#ifndef BENCH_RECORDS
+#define BENCH_RECORDS (4000000U)
+#endif // BENCH_RECORDS
+#ifndef BENCH_BATCH
+#define BENCH_BATCH (32U)
+#endif // BENCH_BATCH
+#define BENCH_CAPACITY (4096U)
+#define BENCH_SHM_NAME "/ring-buffer-bench"
+
+typedef struct {
+    uint64_t sequence;
+    uint8_t payload[56];
+} Record;
+
+static double elapsed_s(const struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double)(end.tv_sec - start->tv_sec) + (double)(end.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+static double bench_pipe(void) {
+    int fds[2];
+    if (pipe(fds) != 0)
+        return 0.0;
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        Record batch[BENCH_BATCH] = { 0 };
+        for (uint64_t i = 0; i < BENCH_RECORDS; i += BENCH_BATCH) {
+            for (size_t j = 0; j < BENCH_BATCH; ++j)
+                batch[j].sequence = i + j;
+            const uint8_t *ptr = (const uint8_t *)batch;
+            size_t left = sizeof(batch);
+            while (left > 0U) {
+                ssize_t n = write(fds[1], ptr, left);
+                if (n <= 0)
+                    _exit(1);
+                ptr += n;
+                left -= (size_t)n;
+            }
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+
+    Record batch[BENCH_BATCH];
+    size_t received = 0;
+    while (received < BENCH_RECORDS * sizeof(Record)) {
+        ssize_t n = read(fds[0], batch, sizeof(batch));
+        if (n <= 0)
+            break;
+        received += (size_t)n;
+    }
+    waitpid(pid, NULL, 0);
+    close(fds[0]);
+    return BENCH_RECORDS / elapsed_s(&start);
+}
+
+static double bench_shm(void) {
+    RingBufferShmHandler_t buffer;
+    ring_buffer_shm_api_unlink(BENCH_SHM_NAME);
+    if (ring_buffer_shm_api_create(&buffer, BENCH_SHM_NAME, sizeof(Record), BENCH_CAPACITY) != RING_BUFFER_OK)
+        return 0.0;
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        RingBufferShmHandler_t producer;
+        if (ring_buffer_shm_api_attach(&producer, BENCH_SHM_NAME) != RING_BUFFER_OK)
+            _exit(1);
+        Record batch[BENCH_BATCH] = { 0 };
+        for (uint64_t i = 0; i < BENCH_RECORDS; i += BENCH_BATCH) {
+            for (size_t j = 0; j < BENCH_BATCH; ++j)
+                batch[j].sequence = i + j;
+            size_t sent = 0;
+            while (sent < BENCH_BATCH) {
+                const size_t n = ring_buffer_shm_api_push_back_n(&producer, batch + sent, BENCH_BATCH - sent);
+                if (n == 0U)
+                    sched_yield();
+                sent += n;
+            }
+        }
+        _exit(0);
+    }
+
+    Record batch[BENCH_BATCH];
+    size_t received = 0;
+    while (received < BENCH_RECORDS) {
+        const size_t n = ring_buffer_shm_api_pop_front_n(&buffer, batch, BENCH_BATCH);
+        if (n == 0U)
+            sched_yield();
+        received += n;
+    }
+    waitpid(pid, NULL, 0);
+    const double rate = BENCH_RECORDS / elapsed_s(&start);
+
+    ring_buffer_shm_api_detach(&buffer);
+    ring_buffer_shm_api_unlink(BENCH_SHM_NAME);
+    return rate;
+}
+
+int main(void) {
+    printf("record size %zu bytes, batch of %u records\n", sizeof(Record), BENCH_BATCH);
+    printf("pipe:          %8.2f Mrecords/s\n", bench_pipe() * 1e-6);
+    printf("shared memory: %8.2f Mrecords/s\n", bench_shm() * 1e-6);
+    return 0;
+}
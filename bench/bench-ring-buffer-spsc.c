@@ -0,0 +1,248 @@
+/*!
+ * \file bench-ring-buffer-spsc.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Cross-core throughput benchmark of the lock-free single-producer/single-consumer
+ *      ring buffer against the standard ring buffer protected by a mutex
+ *
+ * \details A producer thread pushes a fixed number of items to the back of the
+ *      buffer while the main thread pops them from the front, the two threads
+ *      are pinned to the cores given as arguments (0 and 1 by default).
+ *      The number of items transferred per second and the cache misses per
+ *      item (read from the perf counters, if available) are printed for:
+ *      - the standard ring buffer protected by a mutex
+ *      - a lock-free buffer with both indices on the same cache line and
+ *        without cached indices, the layout used before the current one
+ *      - the lock-free buffer of the library
+ *      - the lock-free buffer of the library moving BENCH_BATCH items per
+ *        index update with the batch functions
+ *      The benchmark must be run on a machine with at least two cores to be
+ *      meaningful.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include <linux/perf_event.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ring-buffer-api.h"
+#include "ring-buffer-spsc-api.h"
+
+#ifndef BENCH_ITEMS
+#define BENCH_ITEMS (10000000U)
+#endif // BENCH_ITEMS
+#ifndef BENCH_CAPACITY
+#define BENCH_CAPACITY (1024U)
+#endif // BENCH_CAPACITY
+#ifndef BENCH_BATCH
+#define BENCH_BATCH (64U)
+#endif // BENCH_BATCH
+
+/*! \brief Lock-free buffer with the producer and consumer indices next to each other */
+typedef struct {
+    atomic_size_t head;
+    atomic_size_t tail;
+    size_t slots;
+    uint32_t data[BENCH_CAPACITY + 1U];
+} PackedSpsc;
+
+typedef struct {
+    void *buffer;
+    RingBufferReturnCode (*push)(void *buffer, const void *item);
+    RingBufferReturnCode (*pop)(void *buffer, void *out);
+    size_t (*push_n)(void *buffer, const void *items, size_t count); // Used instead of push if not NULL
+    size_t (*pop_n)(void *buffer, void *out, size_t count); // Used instead of pop if not NULL
+    int core;
+} BenchArgs;
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void cs_enter(void) {
+    pthread_mutex_lock(&mutex);
+}
+
+static void cs_exit(void) {
+    pthread_mutex_unlock(&mutex);
+}
+
+static RingBufferReturnCode mutex_push(void *buffer, const void *item) {
+    return ring_buffer_api_push_back((RingBufferHandler_t *)buffer, (void *)item);
+}
+
+static RingBufferReturnCode mutex_pop(void *buffer, void *out) {
+    return ring_buffer_api_pop_front((RingBufferHandler_t *)buffer, out);
+}
+
+static RingBufferReturnCode packed_push(void *buffer, const void *item) {
+    PackedSpsc *spsc = (PackedSpsc *)buffer;
+    const size_t tail = atomic_load_explicit(&spsc->tail, memory_order_relaxed);
+    const size_t next = tail + 1U >= spsc->slots ? 0U : tail + 1U;
+    if (next == atomic_load_explicit(&spsc->head, memory_order_acquire))
+        return RING_BUFFER_FULL;
+    memcpy(&spsc->data[tail], item, sizeof(uint32_t));
+    atomic_store_explicit(&spsc->tail, next, memory_order_release);
+    return RING_BUFFER_OK;
+}
+
+static RingBufferReturnCode packed_pop(void *buffer, void *out) {
+    PackedSpsc *spsc = (PackedSpsc *)buffer;
+    const size_t head = atomic_load_explicit(&spsc->head, memory_order_relaxed);
+    if (head == atomic_load_explicit(&spsc->tail, memory_order_acquire))
+        return RING_BUFFER_EMPTY;
+    memcpy(out, &spsc->data[head], sizeof(uint32_t));
+    atomic_store_explicit(&spsc->head, head + 1U >= spsc->slots ? 0U : head + 1U, memory_order_release);
+    return RING_BUFFER_OK;
+}
+
+static RingBufferReturnCode spsc_push(void *buffer, const void *item) {
+    return ring_buffer_spsc_api_push_back((RingBufferSpscHandler_t *)buffer, item);
+}
+
+static RingBufferReturnCode spsc_pop(void *buffer, void *out) {
+    return ring_buffer_spsc_api_pop_front((RingBufferSpscHandler_t *)buffer, out);
+}
+
+static size_t spsc_push_n(void *buffer, const void *items, size_t count) {
+    return ring_buffer_spsc_api_push_back_n((RingBufferSpscHandler_t *)buffer, items, count);
+}
+
+static size_t spsc_pop_n(void *buffer, void *out, size_t count) {
+    return ring_buffer_spsc_api_pop_front_n((RingBufferSpscHandler_t *)buffer, out, count);
+}
+
+static double elapsed_s(const struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double)(end.tv_sec - start->tv_sec) + (double)(end.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+static void pin_to_core(int core) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        fprintf(stderr, "cannot pin thread to core %d\n", core);
+}
+
+/*!
+ * \brief Open a hardware cache miss counter for the calling thread and the threads it creates
+ * \return int The file descriptor of the counter, -1 if perf counters are not available
+ */
+static int cache_misses_open(void) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void *producer(void *arg) {
+    BenchArgs *args = (BenchArgs *)arg;
+    pin_to_core(args->core);
+    if (args->push_n != NULL) {
+        uint32_t items[BENCH_BATCH];
+        for (uint32_t i = 0; i < BENCH_ITEMS; i += BENCH_BATCH) {
+            for (uint32_t j = 0; j < BENCH_BATCH; ++j)
+                items[j] = i + j;
+            for (size_t sent = 0; sent < BENCH_BATCH;) {
+                const size_t n = args->push_n(args->buffer, items + sent, BENCH_BATCH - sent);
+                if (n == 0U)
+                    sched_yield();
+                sent += n;
+            }
+        }
+        return NULL;
+    }
+    for (uint32_t i = 0; i < BENCH_ITEMS; ++i) {
+        while (args->push(args->buffer, &i) != RING_BUFFER_OK)
+            sched_yield();
+    }
+    return NULL;
+}
+
+static void bench(const char *name, BenchArgs *args, int consumer_core) {
+    pin_to_core(consumer_core);
+    const int fd = cache_misses_open();
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, producer, args);
+    uint32_t val[BENCH_BATCH];
+    for (uint32_t received = 0; received < BENCH_ITEMS;) {
+        if (args->pop_n != NULL) {
+            const size_t n = args->pop_n(args->buffer, val, BENCH_BATCH);
+            if (n == 0U)
+                sched_yield();
+            received += n;
+        } else if (args->pop(args->buffer, val) == RING_BUFFER_OK)
+            ++received;
+        else
+            sched_yield();
+    }
+    // The counts of the producer are added to the counter when the thread exits
+    pthread_join(thread, NULL);
+    const double throughput = BENCH_ITEMS / elapsed_s(&start);
+
+    uint64_t misses = 0;
+    if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &misses, sizeof(misses)) != sizeof(misses))
+            misses = 0;
+        close(fd);
+        printf("%-22s %8.2f Mitems/s %8.3f cache misses/item\n", name, throughput * 1e-6, (double)misses / BENCH_ITEMS);
+    } else
+        printf("%-22s %8.2f Mitems/s      n/a cache misses/item\n", name, throughput * 1e-6);
+}
+
+int main(int argc, char **argv) {
+    const int consumer_core = argc > 1 ? atoi(argv[1]) : 0;
+    const int producer_core = argc > 2 ? atoi(argv[2]) : 1;
+
+    ArenaAllocatorHandler_t arena;
+    arena_allocator_api_init(&arena);
+
+    RingBufferHandler_t mutex_buffer;
+    ring_buffer_api_init(&mutex_buffer, sizeof(uint32_t), BENCH_CAPACITY, cs_enter, cs_exit, &arena);
+    BenchArgs mutex_args = { &mutex_buffer, mutex_push, mutex_pop, NULL, NULL, producer_core };
+    bench("mutex ring buffer:", &mutex_args, consumer_core);
+
+    static PackedSpsc packed_buffer = { .slots = BENCH_CAPACITY + 1U };
+    BenchArgs packed_args = { &packed_buffer, packed_push, packed_pop, NULL, NULL, producer_core };
+    bench("packed spsc buffer:", &packed_args, consumer_core);
+
+    static RingBufferSpscHandler_t spsc_buffer;
+    ring_buffer_spsc_api_init(&spsc_buffer, sizeof(uint32_t), BENCH_CAPACITY, &arena);
+    BenchArgs spsc_args = { &spsc_buffer, spsc_push, spsc_pop, NULL, NULL, producer_core };
+    bench("spsc ring buffer:", &spsc_args, consumer_core);
+
+    BenchArgs batch_args = { &spsc_buffer, spsc_push, spsc_pop, spsc_push_n, spsc_pop_n, producer_core };
+    bench("spsc batched:", &batch_args, consumer_core);
+
+    arena_allocator_api_free(&arena);
+    return 0;
+}
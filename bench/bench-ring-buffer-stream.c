@@ -0,0 +1,98 @@
+/*!
+ * \file bench-ring-buffer-stream.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Throughput benchmark of the byte-stream write and read functions
+ *      against a loop that pushes and pops one byte at a time
+ *
+ * \details The bytes are moved in chunks of different sizes through a buffer
+ *      protected by a mutex, like a UART driver that receives a burst of
+ *      bytes and a task that parses them.
+ *      Other than the throughput, the CPU load needed to sustain a 1 MB/s
+ *      stream is printed for every chunk size.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "ring-buffer-api.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES (64U * 1024U * 1024U)
+#endif // BENCH_BYTES
+#ifndef BENCH_CAPACITY
+#define BENCH_CAPACITY (4096U)
+#endif // BENCH_CAPACITY
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void cs_enter(void) {
+    pthread_mutex_lock(&mutex);
+}
+
+static void cs_exit(void) {
+    pthread_mutex_unlock(&mutex);
+}
+
+static double elapsed_s(const struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double)(end.tv_sec - start->tv_sec) + (double)(end.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+static double bench_per_byte(RingBufferHandler_t *buffer, const uint8_t *chunk, size_t chunk_size) {
+    uint8_t out[BENCH_CAPACITY];
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t moved = 0; moved < BENCH_BYTES; moved += chunk_size) {
+        for (size_t i = 0; i < chunk_size; ++i)
+            ring_buffer_api_push_back(buffer, (void *)&chunk[i]);
+        for (size_t i = 0; i < chunk_size; ++i)
+            ring_buffer_api_pop_front(buffer, &out[i]);
+    }
+    return BENCH_BYTES / elapsed_s(&start);
+}
+
+static double bench_stream(RingBufferHandler_t *buffer, const uint8_t *chunk, size_t chunk_size) {
+    uint8_t out[BENCH_CAPACITY];
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t moved = 0; moved < BENCH_BYTES; moved += chunk_size) {
+        ring_buffer_api_write(buffer, chunk, chunk_size);
+        ring_buffer_api_read(buffer, out, chunk_size);
+    }
+    return BENCH_BYTES / elapsed_s(&start);
+}
+
+int main(void) {
+    static const size_t chunk_sizes[] = { 1U, 16U, 64U, 256U, 1024U };
+    static uint8_t chunk[BENCH_CAPACITY];
+    for (size_t i = 0; i < BENCH_CAPACITY; ++i)
+        chunk[i] = (uint8_t)i;
+
+    ArenaAllocatorHandler_t arena;
+    arena_allocator_api_init(&arena);
+    RingBufferHandler_t buffer;
+    ring_buffer_api_init(&buffer, sizeof(uint8_t), BENCH_CAPACITY, cs_enter, cs_exit, &arena);
+
+    printf("chunk    per byte MB/s  load @1MB/s    stream MB/s  load @1MB/s\n");
+    for (size_t i = 0; i < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); ++i) {
+        const double per_byte = bench_per_byte(&buffer, chunk, chunk_sizes[i]);
+        const double stream = bench_stream(&buffer, chunk, chunk_sizes[i]);
+        printf("%5zu  %13.2f  %10.4f%%  %13.2f  %10.4f%%\n",
+               chunk_sizes[i],
+               per_byte * 1e-6,
+               100.0 / (per_byte * 1e-6),
+               stream * 1e-6,
+               100.0 / (stream * 1e-6));
+    }
+
+    arena_allocator_api_free(&arena);
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*!
+ * \file bench-ring-buffer-wait.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Latency and CPU usage benchmark of the blocking pop function against
+ *      a consumer that polls the buffer
+ *
+ * \details A producer thread pushes a timestamp every BENCH_PERIOD_US
+ *      microseconds while the main thread receives them with:
+ *      - a busy polling loop
+ *      - a polling loop that sleeps for BENCH_SLEEP_US microseconds when the buffer is empty
+ *      - ring_buffer_api_pop_front_wait
+ *      For each consumer the average and the 99th percentile of the latency
+ *      and the CPU time used by the consumer thread are printed.
+ *      Must be compiled with RING_BUFFER_WAIT defined.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ring-buffer-wait-api.h"
+
+#ifndef BENCH_MESSAGES
+#define BENCH_MESSAGES (2000U)
+#endif // BENCH_MESSAGES
+#ifndef BENCH_PERIOD_US
+#define BENCH_PERIOD_US (500U)
+#endif // BENCH_PERIOD_US
+#ifndef BENCH_SLEEP_US
+#define BENCH_SLEEP_US (1000U)
+#endif // BENCH_SLEEP_US
+
+typedef enum {
+    CONSUMER_BUSY_POLL,
+    CONSUMER_SLEEP_POLL,
+    CONSUMER_WAIT
+} ConsumerType;
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void cs_enter(void) {
+    pthread_mutex_lock(&mutex);
+}
+
+static void cs_exit(void) {
+    pthread_mutex_unlock(&mutex);
+}
+
+static int64_t now_ns(clockid_t clock) {
+    struct timespec now;
+    clock_gettime(clock, &now);
+    return (int64_t)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+static int compare_i64(const void *a, const void *b) {
+    const int64_t x = *(const int64_t *)a;
+    const int64_t y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void *producer(void *arg) {
+    RingBufferHandler_t *buffer = (RingBufferHandler_t *)arg;
+    for (uint32_t i = 0; i < BENCH_MESSAGES; ++i) {
+        usleep(BENCH_PERIOD_US);
+        int64_t sent = now_ns(CLOCK_MONOTONIC);
+        ring_buffer_api_push_back(buffer, &sent);
+    }
+    return NULL;
+}
+
+static void bench(const char *name, ConsumerType type, ArenaAllocatorHandler_t *arena) {
+    static int64_t latencies[BENCH_MESSAGES];
+    RingBufferHandler_t buffer;
+    ring_buffer_api_init(&buffer, sizeof(int64_t), 64, cs_enter, cs_exit, arena);
+
+    const int64_t cpu_start = now_ns(CLOCK_THREAD_CPUTIME_ID);
+    const int64_t wall_start = now_ns(CLOCK_MONOTONIC);
+    pthread_t thread;
+    pthread_create(&thread, NULL, producer, &buffer);
+
+    for (uint32_t received = 0; received < BENCH_MESSAGES;) {
+        int64_t sent;
+        RingBufferReturnCode code;
+        if (type == CONSUMER_WAIT)
+            code = ring_buffer_api_pop_front_wait(&buffer, &sent, -1);
+        else
+            code = ring_buffer_api_pop_front(&buffer, &sent);
+        if (code == RING_BUFFER_OK)
+            latencies[received++] = now_ns(CLOCK_MONOTONIC) - sent;
+        else if (type == CONSUMER_SLEEP_POLL)
+            usleep(BENCH_SLEEP_US);
+    }
+    pthread_join(thread, NULL);
+    const double cpu = (double)(now_ns(CLOCK_THREAD_CPUTIME_ID) - cpu_start);
+    const double wall = (double)(now_ns(CLOCK_MONOTONIC) - wall_start);
+
+    double sum = 0.0;
+    for (uint32_t i = 0; i < BENCH_MESSAGES; ++i)
+        sum += (double)latencies[i];
+    qsort(latencies, BENCH_MESSAGES, sizeof(latencies[0]), compare_i64);
+    printf("%-14s %10.2f us %10.2f us %8.2f %%\n",
+           name,
+           sum / BENCH_MESSAGES * 1e-3,
+           (double)latencies[BENCH_MESSAGES * 99U / 100U] * 1e-3,
+           cpu / wall * 100.0);
+}
+
+int main(void) {
+    ArenaAllocatorHandler_t arena;
+    arena_allocator_api_init(&arena);
+
+    printf("consumer       avg latency  p99 latency  consumer CPU\n");
+    bench("busy poll", CONSUMER_BUSY_POLL, &arena);
+    bench("sleep poll", CONSUMER_SLEEP_POLL, &arena);
+    bench("spin and park", CONSUMER_WAIT, &arena);
+
+    arena_allocator_api_free(&arena);
+    return 0;
+}
@@ -22,6 +22,11 @@
 #include "ring-buffer.h"
 #include "arena-allocator-api.h"
 
+/*!
+ * \brief Position returned by ring_buffer_api_find when the byte is not found
+ */
+#define RING_BUFFER_NOT_FOUND SIZE_MAX
+
 /*!
  * \brief Initialize the buffer
  * \attention The type and capacity parameters must be the same as the ones
@@ -36,7 +41,11 @@
  * \param cs_exit A pointer to a function that should exit a critical section (can be NULL)
  * \param arena The arena allocator handler
  * \return RingBufferReturnCode
- *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_NULL if the buffer handler or the arena are NULL or the
+ *       data cannot be allocated
+ *     - RING_BUFFER_INVALID_ARGUMENT if the data size is 0 or larger than
+ *       RING_BUFFER_MAX_DATA_SIZE, or the rounded capacity or the size of the
+ *       data don't fit in a size_t
  *     - RING_BUFFER_OK otherwise
  */
 RingBufferReturnCode ring_buffer_api_init(
@@ -47,6 +56,89 @@ RingBufferReturnCode ring_buffer_api_init(
    void (*cs_exit)(void),
    ArenaAllocatorHandler_t *arena);
 
+/*!
+ * \brief Initialize the buffer using a memory area provided by the caller
+ * \details The storage is never written by this function, so it can be a
+ *      static array, a region obtained with mmap or any other memory that
+ *      should not be zeroed or touched before it is used.
+ *      If RING_BUFFER_POWER_OF_TWO_CAPACITY is defined the capacity is rounded
+ *      down to a power of two
+ *
+ * \param buffer The buffer handler structure
+ * \param data_size The size of the items
+ * \param capacity The maximum number of elements of the buffer
+ * \param cs_enter A pointer to a function that should manage a critical section (can be NULL)
+ * \param cs_exit A pointer to a function that should exit a critical section (can be NULL)
+ * \param storage A memory area of at least data_size * capacity bytes
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the storage are NULL
+ *     - RING_BUFFER_INVALID_ARGUMENT if the data size is 0 or larger than
+ *       RING_BUFFER_MAX_DATA_SIZE, or the size of the data doesn't fit in a size_t
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_init_static(
+    RingBufferHandler_t *buffer,
+    size_t data_size,
+    size_t capacity,
+    void (*cs_enter)(void),
+    void (*cs_exit)(void),
+    void *storage);
+
+#ifdef RING_BUFFER_EVENT
+#define RING_BUFFER_EVENT_INITIALIZER , .items_fd = -1, .space_fd = -1
+#else
+#define RING_BUFFER_EVENT_INITIALIZER
+#endif // RING_BUFFER_EVENT
+
+/*!
+ * \brief Initializer of a buffer handler that uses a memory area provided by the caller
+ * \details The handler is ready to be used without calling any function, e.g.
+ *      static uint32_t storage[64];
+ *      static RingBufferHandler_t buffer = RING_BUFFER_INITIALIZER(storage, sizeof(uint32_t), 64, ring_buffer_cs_dummy, ring_buffer_cs_dummy);
+ * \attention The critical section functions can't be NULL, use ring_buffer_cs_dummy
+ * instead, and if RING_BUFFER_POWER_OF_TWO_CAPACITY is defined the capacity must
+ * be a power of two. A statically initialized buffer always copies its items
+ * with the generic copy function, use ring_buffer_api_init_static to get the
+ * kernel for the item size
+ *
+ * \param storage A memory area of at least item_size * item_capacity bytes
+ * \param item_size The size of the items
+ * \param item_capacity The maximum number of elements of the buffer
+ * \param enter A pointer to a function that should manage a critical section
+ * \param exit A pointer to a function that should exit a critical section
+ */
+#define RING_BUFFER_INITIALIZER(storage, item_size, item_capacity, enter, exit) \
+    {                                                                          \
+        .start = 0U,                                                           \
+        .size = 0U,                                                            \
+        .data_size = (item_size),                                              \
+        .capacity = (item_capacity),                                           \
+        .cs_enter = (enter),                                                   \
+        .cs_exit = (exit),                                                     \
+        .copy = ring_buffer_api_copy_generic,                                  \
+        .data = (storage) RING_BUFFER_EVENT_INITIALIZER                        \
+    }
+
+/*!
+ * \brief Get the function used to copy single items of the given size
+ * \details Items of 1, 2, 4 and 8 bytes are copied with a single load and
+ *      store, items of 16, 32 and 64 bytes with SIMD registers if available,
+ *      any other size with memcpy
+ *
+ * \param data_size The size of the items
+ * \return RingBufferCopy_t The copy function
+ */
+RingBufferCopy_t ring_buffer_api_copy_kernel(size_t data_size);
+
+/*!
+ * \brief Copy an item of any size with memcpy
+ *
+ * \param dst Where the item is copied into
+ * \param src The item to copy
+ * \param size The size of the item
+ */
+void ring_buffer_api_copy_generic(void *dst, const void *src, size_t size);
+
 /*!
  * \brief Check if the buffer is empty
  *
@@ -95,6 +187,22 @@ RingBufferReturnCode ring_buffer_api_push_front(RingBufferHandler_t *buffer, voi
  */
 RingBufferReturnCode ring_buffer_api_push_back(RingBufferHandler_t *buffer, void *item);
 
+/*!
+ * \brief Insert an element at the end of the buffer removing the oldest one if the buffer is full
+ * \details The 'evicted' parameter can be NULL, the removal and the insertion
+ *      are done inside the same critical section
+ *
+ * \param buffer The buffer handler structure
+ * \param item A pointer to the item to insert
+ * \param evicted A pointer to a variable where the removed item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_FULL if the capacity of the buffer is 0
+ *     - RING_BUFFER_OVERWRITTEN if the buffer was full and the item at the start was removed
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_push_back_overwrite(RingBufferHandler_t *buffer, void *item, void *evicted);
+
 /*!
  * \brief Remove an element from the front of the buffer
  * \details The 'out' parameter can be NULL
@@ -121,6 +229,260 @@ RingBufferReturnCode ring_buffer_api_pop_front(RingBufferHandler_t *buffer, void
  */
 RingBufferReturnCode ring_buffer_api_pop_back(RingBufferHandler_t *buffer, void *out);
 
+/*!
+ * \brief Insert multiple elements at the start of the buffer
+ * \details The items are inserted as a block keeping their order, so after
+ *      the call the first item of the array is the new start of the buffer.
+ *      If there is not enough space only the first items of the array that
+ *      fit are inserted
+ *
+ * \param buffer The buffer handler structure
+ * \param items A pointer to the array of items to insert
+ * \param count The number of items in the array
+ * \return size_t The number of items actually inserted (0 if the buffer
+ *      handler or the items are NULL)
+ */
+size_t ring_buffer_api_push_front_n(RingBufferHandler_t *buffer, const void *items, size_t count);
+
+/*!
+ * \brief Insert multiple elements at the end of the buffer
+ * \details If there is not enough space only the first items of the array
+ *      that fit are inserted
+ *
+ * \param buffer The buffer handler structure
+ * \param items A pointer to the array of items to insert
+ * \param count The number of items in the array
+ * \return size_t The number of items actually inserted (0 if the buffer
+ *      handler or the items are NULL)
+ */
+size_t ring_buffer_api_push_back_n(RingBufferHandler_t *buffer, const void *items, size_t count);
+
+/*!
+ * \brief Remove multiple elements from the front of the buffer
+ * \details The 'out' parameter can be NULL, if the buffer contains less than
+ *      'count' items all of them are removed
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to an array where the removed items are copied into
+ * \param count The maximum number of items to remove
+ * \return size_t The number of items actually removed (0 if the buffer
+ *      handler is NULL)
+ */
+size_t ring_buffer_api_pop_front_n(RingBufferHandler_t *buffer, void *out, size_t count);
+
+/*!
+ * \brief Remove multiple elements from the end of the buffer
+ * \details The 'out' parameter can be NULL, if the buffer contains less than
+ *      'count' items all of them are removed.
+ *      The items are copied in the same order as they are stored in the
+ *      buffer, so the last item of the array is the old end of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to an array where the removed items are copied into
+ * \param count The maximum number of items to remove
+ * \return size_t The number of items actually removed (0 if the buffer
+ *      handler is NULL)
+ */
+size_t ring_buffer_api_pop_back_n(RingBufferHandler_t *buffer, void *out, size_t count);
+
+/*!
+ * \brief Write a range of bytes at the end of a byte-stream buffer
+ * \details The buffer must be initialized with a data size of 1 byte, the
+ *      bytes are copied with a single critical section and if there is not
+ *      enough space only the first bytes that fit are written
+ *
+ * \param buffer The buffer handler structure
+ * \param data A pointer to the bytes to write
+ * \param length The number of bytes to write
+ * \return size_t The number of bytes actually written (0 if the buffer
+ *      handler or the data are NULL or the data size is not 1)
+ */
+size_t ring_buffer_api_write(RingBufferHandler_t *buffer, const void *data, size_t length);
+
+/*!
+ * \brief Read a range of bytes from the front of a byte-stream buffer
+ * \details The buffer must be initialized with a data size of 1 byte, the
+ *      'data' parameter can be NULL to discard the bytes
+ *
+ * \param buffer The buffer handler structure
+ * \param data A pointer to the array where the bytes are copied into
+ * \param length The maximum number of bytes to read
+ * \return size_t The number of bytes actually read (0 if the buffer
+ *      handler is NULL or the data size is not 1)
+ */
+size_t ring_buffer_api_read(RingBufferHandler_t *buffer, void *data, size_t length);
+
+/*!
+ * \brief Find the first occurrence of a byte in a byte-stream buffer
+ * \details The two contiguous segments of the buffer are searched with memchr,
+ *      so the scan is done many bytes at a time instead of one byte per call
+ *
+ * \param buffer The buffer handler structure
+ * \param byte The byte to search
+ * \return size_t The position of the byte from the front of the buffer,
+ *      RING_BUFFER_NOT_FOUND if the buffer handler is NULL, the data size
+ *      is not 1 or the byte is not in the buffer
+ */
+size_t ring_buffer_api_find(RingBufferHandler_t *buffer, uint8_t byte);
+
+/*!
+ * \brief Read from the front of a byte-stream buffer up to and including a delimiter
+ * \details The search and the copy are done with a single critical section,
+ *      the 'data' parameter can be NULL to discard the frame.
+ *      If the delimiter is not in the buffer or the frame is longer than
+ *      'length' nothing is removed, ring_buffer_api_find can be used to tell
+ *      the two cases apart and drop an oversized frame with ring_buffer_api_read
+ *
+ * \param buffer The buffer handler structure
+ * \param delimiter The byte that ends the frame
+ * \param data A pointer to the array where the frame is copied into
+ * \param length The maximum number of bytes to read
+ * \return size_t The number of bytes read including the delimiter (0 if the
+ *      buffer handler is NULL, the data size is not 1 or no complete frame
+ *      fits in 'length' bytes)
+ */
+size_t ring_buffer_api_read_until(RingBufferHandler_t *buffer, uint8_t delimiter, void *data, size_t length);
+
+/*!
+ * \brief Get the bytes at the start of a byte-stream buffer up to and including a delimiter
+ * \details Same as ring_buffer_api_acquire_front but the segments end with
+ *      the first occurrence of the delimiter, once the frame is processed it
+ *      can be removed with ring_buffer_api_release_front(buffer, *len1 + *len2)
+ * \attention The same restrictions of ring_buffer_api_acquire_front apply
+ *
+ * \param buffer The buffer handler structure
+ * \param delimiter The byte that ends the frame
+ * \param seg1 Where the pointer to the first segment is stored
+ * \param len1 Where the number of bytes of the first segment is stored
+ * \param seg2 Where the pointer to the second segment is stored
+ * \param len2 Where the number of bytes of the second segment is stored
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or any of the output parameters are NULL
+ *     - RING_BUFFER_EMPTY if the data size is not 1 or the delimiter is not in the buffer
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_acquire_until(
+    RingBufferHandler_t *buffer,
+    uint8_t delimiter,
+    void **seg1,
+    size_t *len1,
+    void **seg2,
+    size_t *len2);
+
+/*!
+ * \brief Reserve free slots at the end of the buffer to be written in place
+ * \details Up to 'count' free slots are returned as at most two contiguous
+ *      segments, the second one is used only if the reserved range wraps
+ *      around the end of the data array (otherwise 'seg2' is NULL and 'len2' is 0).
+ *      The slots can be written directly (e.g. by a DMA) and are added to the
+ *      buffer only when ring_buffer_api_commit_back is called, the copy is
+ *      therefore done outside of the critical section
+ * \attention Only one producer at a time can hold a reservation and no other
+ *      item should be pushed until the reservation is committed
+ *
+ * \param buffer The buffer handler structure
+ * \param count The maximum number of slots to reserve
+ * \param seg1 Where the pointer to the first segment is stored
+ * \param len1 Where the number of slots of the first segment is stored
+ * \param seg2 Where the pointer to the second segment is stored
+ * \param len2 Where the number of slots of the second segment is stored
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or any of the output parameters are NULL
+ *     - RING_BUFFER_FULL if the buffer is full
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_reserve_back(
+    RingBufferHandler_t *buffer,
+    size_t count,
+    void **seg1,
+    size_t *len1,
+    void **seg2,
+    size_t *len2);
+
+/*!
+ * \brief Add to the end of the buffer the items written in the reserved slots
+ * \details The first 'count' slots after the end of the buffer are added
+ *      as items, 'count' can be less than the number of reserved slots
+ *
+ * \param buffer The buffer handler structure
+ * \param count The number of items to add
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_FULL if there are less than 'count' free slots
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_commit_back(RingBufferHandler_t *buffer, size_t count);
+
+/*!
+ * \brief Get the items at the start of the buffer to be read in place
+ * \details Up to 'count' items are returned as at most two contiguous
+ *      segments, the second one is used only if the items wrap around the
+ *      end of the data array (otherwise 'seg2' is NULL and 'len2' is 0).
+ *      The items stay in the buffer until ring_buffer_api_release_front is
+ *      called, so they can be processed without copying them out
+ * \attention The items remain valid only as long as they are not removed
+ *      from the front of the buffer by someone else, only one consumer at a
+ *      time should acquire them and the buffer should not be cleared meanwhile
+ *
+ * \param buffer The buffer handler structure
+ * \param count The maximum number of items to get
+ * \param seg1 Where the pointer to the first segment is stored
+ * \param len1 Where the number of items of the first segment is stored
+ * \param seg2 Where the pointer to the second segment is stored
+ * \param len2 Where the number of items of the second segment is stored
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or any of the output parameters are NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_acquire_front(
+    RingBufferHandler_t *buffer,
+    size_t count,
+    void **seg1,
+    size_t *len1,
+    void **seg2,
+    size_t *len2);
+
+/*!
+ * \brief Remove from the start of the buffer the items that were read in place
+ * \details 'count' can be less than the number of acquired items, in that
+ *      case the remaining ones stay at the start of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param count The number of items to remove
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if the buffer contains less than 'count' items
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_release_front(RingBufferHandler_t *buffer, size_t count);
+
+/*!
+ * \brief Get the largest contiguous range of items at the start of the buffer
+ * \details Useful for readers that are not part of the library (e.g. a DMA
+ *      transfer or a send system call), once the items are consumed they can
+ *      be removed with ring_buffer_api_release_front
+ *
+ * \param buffer The buffer handler structure
+ * \param count Where the number of items of the range is stored
+ * \return void * A pointer to the first item, NULL if the buffer handler or
+ *      count are NULL or the buffer is empty
+ */
+void *ring_buffer_api_front_span(RingBufferHandler_t *buffer, size_t *count);
+
+/*!
+ * \brief Get the largest contiguous range of free slots at the end of the buffer
+ * \details Useful for writers that are not part of the library (e.g. a DMA
+ *      transfer or a recv system call), once the slots are filled they can
+ *      be added to the buffer with ring_buffer_api_commit_back
+ *
+ * \param buffer The buffer handler structure
+ * \param count Where the number of free slots of the range is stored
+ * \return void * A pointer to the first free slot, NULL if the buffer handler
+ *      or count are NULL or the buffer is full
+ */
+void *ring_buffer_api_back_span(RingBufferHandler_t *buffer, size_t *count);
+
 /*!
  * \brief Get a copy of the element at the start of the buffer
  *
@@ -165,6 +527,117 @@ void *ring_buffer_api_peek_front(RingBufferHandler_t *buffer);
  */
 void *ring_buffer_api_peek_back(RingBufferHandler_t *buffer);
 
+/*!
+ * \brief Get a copy of the element at a position from the start of the buffer
+ * \details Index 0 is the element at the start of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param index The position of the element
+ * \param out A pointer to a variable where the item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or out are NULL
+ *     - RING_BUFFER_EMPTY if the index is not less than the size of the buffer
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_at(RingBufferHandler_t *buffer, size_t index, void *out);
+
+/*!
+ * \brief Get a copy of the element at a position from the end of the buffer
+ * \details Index 0 is the element at the end of the buffer, e.g. index k is
+ *      the item pushed k pushes ago
+ *
+ * \param buffer The buffer handler structure
+ * \param index The position of the element
+ * \param out A pointer to a variable where the item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or out are NULL
+ *     - RING_BUFFER_EMPTY if the index is not less than the size of the buffer
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_at_back(RingBufferHandler_t *buffer, size_t index, void *out);
+
+/*!
+ * \brief Overwrite the element at a position from the start of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param index The position of the element
+ * \param item A pointer to the new value of the item
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_EMPTY if the index is not less than the size of the buffer
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_set(RingBufferHandler_t *buffer, size_t index, const void *item);
+
+/*!
+ * \brief Overwrite the element at a position from the end of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param index The position of the element
+ * \param item A pointer to the new value of the item
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_EMPTY if the index is not less than the size of the buffer
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_set_back(RingBufferHandler_t *buffer, size_t index, const void *item);
+
+/*!
+ * \brief Visit the items of the buffer from the front to the back without removing them
+ * \details The whole visit is done in a single critical section and in at most
+ *      two linear passes over the data array, the visitor must not call other
+ *      functions of the same buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param visitor The function called for each item, returns false to stop the visit
+ * \param ctx A pointer passed to each call of the visitor (can be NULL)
+ * \return size_t The number of visited items, 0 if the buffer handler or the visitor are NULL
+ */
+size_t ring_buffer_api_for_each(RingBufferHandler_t *buffer, RingBufferVisitor_t visitor, void *ctx);
+
+/*!
+ * \brief Visit the items of the buffer from the back to the front without removing them
+ * \details The whole visit is done in a single critical section and in at most
+ *      two linear passes over the data array, the visitor must not call other
+ *      functions of the same buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param visitor The function called for each item, returns false to stop the visit
+ * \param ctx A pointer passed to each call of the visitor (can be NULL)
+ * \return size_t The number of visited items, 0 if the buffer handler or the visitor are NULL
+ */
+size_t ring_buffer_api_for_each_reverse(RingBufferHandler_t *buffer, RingBufferVisitor_t visitor, void *ctx);
+
+/*!
+ * \brief Start visiting the items of the buffer with a cursor
+ * \details The critical section is entered here and exited by
+ *      ring_buffer_api_iter_end, no other function of the same buffer can be
+ *      called in between
+ *
+ * \param buffer The buffer handler structure
+ * \param it The cursor to initialize
+ * \param reverse False to visit the items from the front, true from the back
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the cursor are NULL
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_iter_begin(RingBufferHandler_t *buffer, RingBufferIterator_t *it, bool reverse);
+
+/*!
+ * \brief Get the next item of the visit
+ *
+ * \param it The cursor started with ring_buffer_api_iter_begin
+ * \return void * A pointer to the item inside the buffer, NULL if all the items were visited
+ */
+void *ring_buffer_api_iter_next(RingBufferIterator_t *it);
+
+/*!
+ * \brief Stop visiting the items and exit the critical section
+ *
+ * \param it The cursor started with ring_buffer_api_iter_begin
+ */
+void ring_buffer_api_iter_end(RingBufferIterator_t *it);
+
 /*!
  * \brief Clear the buffer removing all items
  * \details The actual data is not erased, only the size is modified
@@ -176,6 +649,159 @@ void *ring_buffer_api_peek_back(RingBufferHandler_t *buffer);
  */
 RingBufferReturnCode ring_buffer_api_clear(RingBufferHandler_t *buffer);
 
+#ifdef RING_BUFFER_STATS
+/*!
+ * \brief Get a copy of the runtime statistics of the buffer
+ * \details The time spent in the critical section is measured only if
+ *      RING_BUFFER_STATS_CLOCK is defined at compile time as an expression
+ *      that returns the current time, e.g. a cycle counter on a microcontroller
+ *      or clock_gettime on Linux
+ *
+ * \param buffer The buffer handler structure
+ * \param stats A pointer to a structure where the statistics are copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or stats are NULL
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_stats(RingBufferHandler_t *buffer, RingBufferStats_t *stats);
+
+/*!
+ * \brief Reset the runtime statistics of the buffer
+ * \details The high watermark is set to the current size of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_stats_reset(RingBufferHandler_t *buffer);
+#endif // RING_BUFFER_STATS
+
+/*!
+ * \brief Set a lock policy with its own context that replaces cs_enter and cs_exit
+ * \details Must be called before the buffer is shared with other threads
+ *
+ * \param buffer The buffer handler structure
+ * \param policy The lock policy, NULL to use cs_enter and cs_exit again
+ * \param ctx The context passed to the functions of the policy, e.g. the lock itself
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_set_lock(RingBufferHandler_t *buffer, const RingBufferLockPolicy_t *policy, void *ctx);
+
+/*!
+ * \brief Enter the critical section of the buffer with its lock policy or with cs_enter
+ *
+ * \param buffer The buffer handler structure
+ */
+static inline void ring_buffer_api_lock(RingBufferHandler_t *buffer) {
+    if (buffer->lock != NULL)
+        buffer->lock->enter(buffer->lock_ctx);
+    else
+        buffer->cs_enter();
+}
+
+/*!
+ * \brief Exit the critical section of the buffer with its lock policy or with cs_exit
+ *
+ * \param buffer The buffer handler structure
+ */
+static inline void ring_buffer_api_unlock(RingBufferHandler_t *buffer) {
+    if (buffer->lock != NULL)
+        buffer->lock->exit(buffer->lock_ctx);
+    else
+        buffer->cs_exit();
+}
+
+/*!
+ * \brief Update the statistics after a push operation
+ * \details Used by the functions that add items, must be called inside the
+ *      critical section and does nothing if RING_BUFFER_STATS is not defined
+ *
+ * \param buffer The buffer handler structure
+ * \param pushed The number of items added
+ * \param requested The number of items that should have been added
+ */
+static inline void ring_buffer_api_stats_pushed(RingBufferHandler_t *buffer, size_t pushed, size_t requested) {
+#ifdef RING_BUFFER_STATS
+    buffer->stats.pushes += pushed;
+    if (pushed < requested)
+        ++buffer->stats.full;
+    if (buffer->size > buffer->stats.high_watermark)
+        buffer->stats.high_watermark = buffer->size;
+#else
+    (void)buffer;
+    (void)pushed;
+    (void)requested;
+#endif // RING_BUFFER_STATS
+}
+
+/*!
+ * \brief Update the statistics after a pop operation
+ * \details Used by the functions that remove items, must be called inside the
+ *      critical section and does nothing if RING_BUFFER_STATS is not defined
+ *
+ * \param buffer The buffer handler structure
+ * \param popped The number of items removed
+ * \param requested The number of items that should have been removed
+ */
+static inline void ring_buffer_api_stats_popped(RingBufferHandler_t *buffer, size_t popped, size_t requested) {
+#ifdef RING_BUFFER_STATS
+    buffer->stats.pops += popped;
+    if (popped < requested)
+        ++buffer->stats.empty;
+#else
+    (void)buffer;
+    (void)popped;
+    (void)requested;
+#endif // RING_BUFFER_STATS
+}
+
+/*!
+ * \brief Wrap an index of the buffer around its capacity
+ * \details If RING_BUFFER_POWER_OF_TWO_CAPACITY is defined the capacity is
+ *      always a power of two and the index is masked, otherwise a single
+ *      compare and subtract is done
+ *
+ * \param buffer The buffer handler structure
+ * \param index The index to wrap, must be less than twice the capacity
+ * \return size_t The wrapped index
+ */
+static inline size_t ring_buffer_api_wrap(const RingBufferHandler_t *buffer, size_t index) {
+#ifdef RING_BUFFER_POWER_OF_TWO_CAPACITY
+    return index & (buffer->capacity - 1U);
+#else
+    return index >= buffer->capacity ? index - buffer->capacity : index;
+#endif // RING_BUFFER_POWER_OF_TWO_CAPACITY
+}
+
+/*!
+ * \brief Get a pointer to the element at a position from the start of the buffer
+ * \attention No check is done on the parameters and no critical section is
+ * used, the index must be less than the size of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param index The position of the element
+ * \return void * A pointer to the item inside the buffer
+ */
+static inline void *ring_buffer_api_at_unchecked(const RingBufferHandler_t *buffer, size_t index) {
+    return (uint8_t *)buffer->data + ring_buffer_api_wrap(buffer, buffer->start + index) * buffer->data_size;
+}
+
+/*!
+ * \brief Get a pointer to the element at a position from the end of the buffer
+ * \attention No check is done on the parameters and no critical section is
+ * used, the index must be less than the size of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param index The position of the element
+ * \return void * A pointer to the item inside the buffer
+ */
+static inline void *ring_buffer_api_at_back_unchecked(const RingBufferHandler_t *buffer, size_t index) {
+    return ring_buffer_api_at_unchecked(buffer, buffer->size - 1U - index);
+}
+
 // Function that substitute cs_enter and cs_exit if they are NULL
 void ring_buffer_cs_dummy(void);
 
@@ -0,0 +1,114 @@
+/*!
+ * \file ring-buffer-event-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Event file descriptors for Linux that allow waiting for the buffer
+ *      with poll, select or epoll together with other file descriptors
+ *
+ * \details The items descriptor becomes readable when the buffer goes from
+ *      empty to non-empty and the space descriptor, if a threshold is given,
+ *      becomes readable when the number of items drops below the threshold,
+ *      i.e. when the buffer becomes writable.
+ *      Notifications are coalesced: once a descriptor is signaled the
+ *      following pushes or pops do not make any system call until the
+ *      application acknowledges it, so a burst of operations costs a single
+ *      write to the descriptor.
+ *      These functions are available only if RING_BUFFER_EVENT is defined at
+ *      compile time for both the library and the application, since it adds
+ *      the descriptors to the buffer handler.
+ */
+
+#ifndef RING_BUFFER_EVENT_API_H
+#define RING_BUFFER_EVENT_API_H
+
+#if defined(__linux__) && defined(RING_BUFFER_EVENT)
+
+#include "ring-buffer-api.h"
+
+/*!
+ * \brief Create the event file descriptors of the buffer
+ * \details The descriptors are non-blocking, if the buffer already contains
+ *      items or is below the threshold the descriptors are signaled immediately.
+ *      If the descriptors were already created they are closed and replaced
+ *
+ * \param buffer The buffer handler structure
+ * \param space_threshold The size below which the space descriptor is signaled, 0 to not create it
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL or the descriptors cannot be created
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_event_api_init(RingBufferHandler_t *buffer, size_t space_threshold);
+
+/*!
+ * \brief Close the event file descriptors of the buffer
+ *
+ * \param buffer The buffer handler structure
+ */
+void ring_buffer_event_api_deinit(RingBufferHandler_t *buffer);
+
+/*!
+ * \brief Get the descriptor that is readable when the buffer contains items
+ *
+ * \param buffer The buffer handler structure
+ * \return int The file descriptor, -1 if the buffer handler is NULL or it was not created
+ */
+int ring_buffer_event_api_items_fd(const RingBufferHandler_t *buffer);
+
+/*!
+ * \brief Get the descriptor that is readable when the size of the buffer is below the threshold
+ *
+ * \param buffer The buffer handler structure
+ * \return int The file descriptor, -1 if the buffer handler is NULL or it was not created
+ */
+int ring_buffer_event_api_space_fd(const RingBufferHandler_t *buffer);
+
+/*!
+ * \brief Acknowledge the items descriptor
+ * \details Must be called after the buffer was drained, the descriptor is
+ *      reset and signaled again if items were added in the meantime
+ *
+ * \param buffer The buffer handler structure
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL or the descriptor was not created
+ *     - RING_BUFFER_EMPTY if the buffer is empty and the descriptor is no longer readable
+ *     - RING_BUFFER_OK if the buffer still contains items
+ */
+RingBufferReturnCode ring_buffer_event_api_items_ack(RingBufferHandler_t *buffer);
+
+/*!
+ * \brief Acknowledge the space descriptor
+ * \details Must be called after the buffer was filled, the descriptor is
+ *      reset and signaled again if the size is still below the threshold
+ *
+ * \param buffer The buffer handler structure
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL or the descriptor was not created
+ *     - RING_BUFFER_FULL if the size is not below the threshold and the descriptor is no longer readable
+ *     - RING_BUFFER_OK if the size is still below the threshold
+ */
+RingBufferReturnCode ring_buffer_event_api_space_ack(RingBufferHandler_t *buffer);
+
+/*!
+ * \brief Signal the items descriptor if it is not already signaled
+ * \details Called by the ring_buffer_api functions after adding items
+ *
+ * \param buffer The buffer handler structure
+ */
+void ring_buffer_event_api_notify_items(RingBufferHandler_t *buffer);
+
+/*!
+ * \brief Signal the space descriptor if the size is below the threshold and it is not already signaled
+ * \details Called by the ring_buffer_api functions after removing items with
+ *      the size read inside their critical section, so the critical section
+ *      is not entered again
+ *
+ * \param buffer The buffer handler structure
+ * \param size The number of items left in the buffer
+ */
+void ring_buffer_event_api_notify_space(RingBufferHandler_t *buffer, size_t size);
+
+#endif // __linux__ && RING_BUFFER_EVENT
+
+#endif // RING_BUFFER_EVENT_API_H
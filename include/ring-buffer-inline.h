@@ -0,0 +1,309 @@
+/*!
+ * \file ring-buffer-inline.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Header-only static inline version of the most used ring buffer
+ *      functions, with the critical section chosen at compile time
+ *
+ * \details The functions work on the same handler of ring-buffer-api.h and
+ *      have the same behaviour of the ring_buffer_api functions with the same
+ *      suffix, so the two can be mixed on the same buffer.
+ *      The critical section is entered with RING_BUFFER_INLINE_CS_ENTER and
+ *      exited with RING_BUFFER_INLINE_CS_EXIT, which call the lock policy or
+ *      cs_enter and cs_exit of the buffer by default. They can be defined
+ *      before including this header, e.g. to disable the interrupts directly,
+ *      or RING_BUFFER_INLINE_NO_LOCK can be defined to remove the critical
+ *      section, so that the functions compile to straight-line code.
+ *      If all the buffers used by a translation unit have the same item size,
+ *      RING_BUFFER_INLINE_DATA_SIZE can be defined as that size so that every
+ *      copy is done with a constant size.
+ *
+ *      Example:
+ *      \code
+ *      #define RING_BUFFER_INLINE_NO_LOCK
+ *      #define RING_BUFFER_INLINE_DATA_SIZE(buffer) sizeof(uint32_t)
+ *      #include "ring-buffer-inline.h"
+ *
+ *      ring_buffer_inline_push_back(&samples, &sample);
+ *      \endcode
+ *
+ * \attention The time spent in the critical section is not added to the
+ * statistics, the other counters are updated
+ */
+
+#ifndef RING_BUFFER_INLINE_H
+#define RING_BUFFER_INLINE_H
+
+#include <string.h>
+
+#include "ring-buffer-api.h"
+
+#ifdef RING_BUFFER_WAIT
+#include "ring-buffer-wait-api.h"
+#endif // RING_BUFFER_WAIT
+#ifdef RING_BUFFER_EVENT
+#include "ring-buffer-event-api.h"
+#endif // RING_BUFFER_EVENT
+
+#ifdef RING_BUFFER_INLINE_NO_LOCK
+#define RING_BUFFER_INLINE_CS_ENTER(buffer) ((void)(buffer))
+#define RING_BUFFER_INLINE_CS_EXIT(buffer) ((void)(buffer))
+#endif // RING_BUFFER_INLINE_NO_LOCK
+
+#ifndef RING_BUFFER_INLINE_CS_ENTER
+#define RING_BUFFER_INLINE_CS_ENTER(buffer) ring_buffer_api_lock(buffer)
+#endif // RING_BUFFER_INLINE_CS_ENTER
+#ifndef RING_BUFFER_INLINE_CS_EXIT
+#define RING_BUFFER_INLINE_CS_EXIT(buffer) ring_buffer_api_unlock(buffer)
+#endif // RING_BUFFER_INLINE_CS_EXIT
+
+/*!
+ * \brief Get a pointer to the slot at a position from the start of the buffer
+ * \details The slot offset is computed with the constant item size if
+ *      RING_BUFFER_INLINE_DATA_SIZE is defined, otherwise with the data size
+ *      of the buffer. The position can be equal to the size of the buffer to
+ *      get the first free slot at the end
+ *
+ * \param buffer The buffer handler structure
+ * \param index The position of the slot
+ * \return void * A pointer to the slot inside the buffer
+ */
+static inline void *ring_buffer_inline_slot(const RingBufferHandler_t *buffer, size_t index) {
+    const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + index);
+#ifdef RING_BUFFER_INLINE_DATA_SIZE
+    return (uint8_t *)buffer->data + cur * RING_BUFFER_INLINE_DATA_SIZE(buffer);
+#else
+    return (uint8_t *)buffer->data + cur * buffer->data_size;
+#endif // RING_BUFFER_INLINE_DATA_SIZE
+}
+
+/*!
+ * \brief Copy a single item of the buffer
+ * \details Uses a constant size memcpy if RING_BUFFER_INLINE_DATA_SIZE is
+ *      defined, otherwise the copy function chosen for the buffer during the
+ *      initialization
+ *
+ * \param buffer The buffer handler structure
+ * \param dst Where the item is copied into
+ * \param src The item to copy
+ */
+static inline void ring_buffer_inline_copy(const RingBufferHandler_t *buffer, void *dst, const void *src) {
+#ifdef RING_BUFFER_INLINE_DATA_SIZE
+    (void)buffer;
+    memcpy(dst, src, RING_BUFFER_INLINE_DATA_SIZE(buffer));
+#else
+    buffer->copy(dst, src, buffer->data_size);
+#endif // RING_BUFFER_INLINE_DATA_SIZE
+}
+
+/*!
+ * \brief Notify the waiting threads and the event file descriptors that an item was added
+ *
+ * \param buffer The buffer handler structure
+ */
+static inline void ring_buffer_inline_notify_items(RingBufferHandler_t *buffer) {
+#ifdef RING_BUFFER_WAIT
+    ring_buffer_wait_api_notify_items(buffer, 1U);
+#endif // RING_BUFFER_WAIT
+#ifdef RING_BUFFER_EVENT
+    ring_buffer_event_api_notify_items(buffer);
+#endif // RING_BUFFER_EVENT
+    (void)buffer;
+}
+
+/*!
+ * \brief Notify the waiting threads and the event file descriptors that an item was removed
+ *
+ * \param buffer The buffer handler structure
+ * \param size The number of items left, read inside the critical section of the removal
+ */
+static inline void ring_buffer_inline_notify_space(RingBufferHandler_t *buffer, size_t size) {
+#ifdef RING_BUFFER_WAIT
+    ring_buffer_wait_api_notify_space(buffer, 1U);
+#endif // RING_BUFFER_WAIT
+#ifdef RING_BUFFER_EVENT
+    ring_buffer_event_api_notify_space(buffer, size);
+#endif // RING_BUFFER_EVENT
+    (void)buffer;
+    (void)size;
+}
+
+/*!
+ * \brief Insert an element at the end of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param item A pointer to the item to insert
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_FULL if the buffer is full
+ *     - RING_BUFFER_OK otherwise
+ */
+static inline RingBufferReturnCode ring_buffer_inline_push_back(RingBufferHandler_t *buffer, const void *item) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    RING_BUFFER_INLINE_CS_ENTER(buffer);
+
+    if (buffer->size >= buffer->capacity) {
+        ring_buffer_api_stats_pushed(buffer, 0U, 1U);
+        RING_BUFFER_INLINE_CS_EXIT(buffer);
+        return RING_BUFFER_FULL;
+    }
+    ring_buffer_inline_copy(buffer, ring_buffer_inline_slot(buffer, buffer->size), item);
+    ++buffer->size;
+    ring_buffer_api_stats_pushed(buffer, 1U, 1U);
+
+    RING_BUFFER_INLINE_CS_EXIT(buffer);
+    ring_buffer_inline_notify_items(buffer);
+    return RING_BUFFER_OK;
+}
+
+/*!
+ * \brief Insert an element at the start of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param item A pointer to the item to insert
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_FULL if the buffer is full
+ *     - RING_BUFFER_OK otherwise
+ */
+static inline RingBufferReturnCode ring_buffer_inline_push_front(RingBufferHandler_t *buffer, const void *item) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    RING_BUFFER_INLINE_CS_ENTER(buffer);
+
+    if (buffer->size >= buffer->capacity) {
+        ring_buffer_api_stats_pushed(buffer, 0U, 1U);
+        RING_BUFFER_INLINE_CS_EXIT(buffer);
+        return RING_BUFFER_FULL;
+    }
+    buffer->start = ring_buffer_api_wrap(buffer, buffer->start + buffer->capacity - 1U);
+    ring_buffer_inline_copy(buffer, ring_buffer_inline_slot(buffer, 0U), item);
+    ++buffer->size;
+    ring_buffer_api_stats_pushed(buffer, 1U, 1U);
+
+    RING_BUFFER_INLINE_CS_EXIT(buffer);
+    ring_buffer_inline_notify_items(buffer);
+    return RING_BUFFER_OK;
+}
+
+/*!
+ * \brief Remove an element from the start of the buffer
+ * \details The 'out' parameter can be NULL
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the removed item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+static inline RingBufferReturnCode ring_buffer_inline_pop_front(RingBufferHandler_t *buffer, void *out) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    RING_BUFFER_INLINE_CS_ENTER(buffer);
+
+    if (buffer->size == 0U) {
+        ring_buffer_api_stats_popped(buffer, 0U, 1U);
+        RING_BUFFER_INLINE_CS_EXIT(buffer);
+        return RING_BUFFER_EMPTY;
+    }
+    if (out != NULL)
+        ring_buffer_inline_copy(buffer, out, ring_buffer_inline_slot(buffer, 0U));
+    buffer->start = ring_buffer_api_wrap(buffer, buffer->start + 1U);
+    --buffer->size;
+    ring_buffer_api_stats_popped(buffer, 1U, 1U);
+
+    const size_t remaining = buffer->size;
+    RING_BUFFER_INLINE_CS_EXIT(buffer);
+    ring_buffer_inline_notify_space(buffer, remaining);
+    return RING_BUFFER_OK;
+}
+
+/*!
+ * \brief Remove an element from the end of the buffer
+ * \details The 'out' parameter can be NULL
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the removed item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+static inline RingBufferReturnCode ring_buffer_inline_pop_back(RingBufferHandler_t *buffer, void *out) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    RING_BUFFER_INLINE_CS_ENTER(buffer);
+
+    if (buffer->size == 0U) {
+        ring_buffer_api_stats_popped(buffer, 0U, 1U);
+        RING_BUFFER_INLINE_CS_EXIT(buffer);
+        return RING_BUFFER_EMPTY;
+    }
+    if (out != NULL)
+        ring_buffer_inline_copy(buffer, out, ring_buffer_inline_slot(buffer, buffer->size - 1U));
+    --buffer->size;
+    ring_buffer_api_stats_popped(buffer, 1U, 1U);
+
+    const size_t remaining = buffer->size;
+    RING_BUFFER_INLINE_CS_EXIT(buffer);
+    ring_buffer_inline_notify_space(buffer, remaining);
+    return RING_BUFFER_OK;
+}
+
+/*!
+ * \brief Get a copy of the element at the start of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or out are NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+static inline RingBufferReturnCode ring_buffer_inline_front(RingBufferHandler_t *buffer, void *out) {
+    if (buffer == NULL || out == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    RING_BUFFER_INLINE_CS_ENTER(buffer);
+
+    const bool empty = buffer->size == 0U;
+    if (!empty)
+        ring_buffer_inline_copy(buffer, out, ring_buffer_inline_slot(buffer, 0U));
+
+    RING_BUFFER_INLINE_CS_EXIT(buffer);
+    return empty ? RING_BUFFER_EMPTY : RING_BUFFER_OK;
+}
+
+/*!
+ * \brief Get a copy of the element at the end of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or out are NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+static inline RingBufferReturnCode ring_buffer_inline_back(RingBufferHandler_t *buffer, void *out) {
+    if (buffer == NULL || out == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    RING_BUFFER_INLINE_CS_ENTER(buffer);
+
+    const bool empty = buffer->size == 0U;
+    if (!empty)
+        ring_buffer_inline_copy(buffer, out, ring_buffer_inline_slot(buffer, buffer->size - 1U));
+
+    RING_BUFFER_INLINE_CS_EXIT(buffer);
+    return empty ? RING_BUFFER_EMPTY : RING_BUFFER_OK;
+}
+
+#endif // RING_BUFFER_INLINE_H
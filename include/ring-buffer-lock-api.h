@@ -0,0 +1,46 @@
+/*!
+ * \file ring-buffer-lock-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Lock policies that protect each ring buffer with its own lock
+ *
+ * \details The lock is passed as the context of the policy, e.g.
+ *      static RingBufferSpinlock_t lock;
+ *      ring_buffer_lock_api_spinlock_init(&lock);
+ *      ring_buffer_api_set_lock(&buffer, &ring_buffer_lock_spinlock, &lock);
+ */
+
+#ifndef RING_BUFFER_LOCK_API_H
+#define RING_BUFFER_LOCK_API_H
+
+#include "ring-buffer-lock.h"
+#include "ring-buffer-api.h"
+
+/*! \brief Lock policy that uses a RingBufferSpinlock_t as context */
+extern const RingBufferLockPolicy_t ring_buffer_lock_spinlock;
+
+/*! \brief Lock policy that uses a RingBufferTicketLock_t as context */
+extern const RingBufferLockPolicy_t ring_buffer_lock_ticket;
+
+#ifdef __linux__
+/*! \brief Lock policy that uses an initialized pthread_mutex_t as context */
+extern const RingBufferLockPolicy_t ring_buffer_lock_pthread_mutex;
+#endif // __linux__
+
+/*!
+ * \brief Initialize a spinlock in the unlocked state
+ *
+ * \param lock The spinlock
+ */
+void ring_buffer_lock_api_spinlock_init(RingBufferSpinlock_t *lock);
+
+/*!
+ * \brief Initialize a ticket lock in the unlocked state
+ *
+ * \param lock The ticket lock
+ */
+void ring_buffer_lock_api_ticket_init(RingBufferTicketLock_t *lock);
+
+#endif // RING_BUFFER_LOCK_API_H
@@ -0,0 +1,47 @@
+/*!
+ * \file ring-buffer-lock.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Locks that can be used as the per-buffer lock policy of the ring buffer
+ *
+ * \details Each buffer gets its own lock as the context of the policy, so
+ *      independent buffers never contend with each other.
+ *      The spinlock is the smallest and fastest when the critical sections are
+ *      short and there is little contention, the ticket lock grants the lock
+ *      in arrival order so that no thread starves, and on Linux the pthread
+ *      mutex puts the waiting threads to sleep.
+ */
+
+#ifndef RING_BUFFER_LOCK_H
+#define RING_BUFFER_LOCK_H
+
+#include <stdatomic.h>
+
+#include "ring-buffer.h"
+
+/*!
+ * \brief Number of attempts after which a thread waiting for a lock yields the core on Linux
+ * \details Can be overridden at compile time
+ */
+#ifndef RING_BUFFER_LOCK_SPIN_LIMIT
+#define RING_BUFFER_LOCK_SPIN_LIMIT (1024U)
+#endif // RING_BUFFER_LOCK_SPIN_LIMIT
+
+/*!
+ * \brief Test-and-test-and-set spinlock
+ */
+typedef struct {
+    atomic_bool locked;
+} RingBufferSpinlock_t;
+
+/*!
+ * \brief Ticket lock, the lock is granted in the same order it is requested
+ */
+typedef struct {
+    atomic_uint next;    // Ticket given to the next thread that requests the lock
+    atomic_uint serving; // Ticket of the thread that owns the lock
+} RingBufferTicketLock_t;
+
+#endif // RING_BUFFER_LOCK_H
@@ -0,0 +1,87 @@
+/*!
+ * \file ring-buffer-mirror-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Ring buffer backend for Linux where the data is mapped twice
+ *      back-to-back in virtual memory
+ *
+ * \details The storage of the buffer is a memory file which is mapped two
+ *      times in consecutive virtual addresses, so the slot after the last one
+ *      is the first one again. Every range of items or free slots is therefore
+ *      contiguous in memory and can be read or written with a single
+ *      operation (e.g. a memcpy, a parser or a write() call) without
+ *      handling the wrap around the end of the buffer.
+ *      The initialized handler can be used with every ring_buffer_api function.
+ *
+ * \warning The data buffer is not allocated with an arena allocator and has
+ *      to be released with ring_buffer_mirror_api_deinit.
+ */
+
+#ifndef RING_BUFFER_MIRROR_API_H
+#define RING_BUFFER_MIRROR_API_H
+
+#ifdef __linux__
+
+#include "ring-buffer-api.h"
+
+/*!
+ * \brief Initialize the buffer with a mirrored memory mapping
+ * \details The capacity is rounded up so that the size of the data is a
+ *      multiple of the page size (and to a power of two if
+ *      RING_BUFFER_POWER_OF_TWO_CAPACITY is defined)
+ *
+ * \param buffer The buffer hanler structure
+ * \param data_size The size of a single item in bytes
+ * \param capacity The minimum number of elements of the buffer
+ * \param cs_enter A pointer to a function that should manage a critical section (can be NULL)
+ * \param cs_exit A pointer to a function that should exit a critical section (can be NULL)
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL or the memory cannot be mapped
+ *     - RING_BUFFER_INVALID_ARGUMENT if the data size is 0 or larger than
+ *       RING_BUFFER_MAX_DATA_SIZE, or the rounded capacity doesn't fit in the address space
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_mirror_api_init(
+    RingBufferHandler_t *buffer,
+    size_t data_size,
+    size_t capacity,
+    void (*cs_enter)(void),
+    void (*cs_exit)(void));
+
+/*!
+ * \brief Release the memory mapping of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or its data are NULL
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_mirror_api_deinit(RingBufferHandler_t *buffer);
+
+/*!
+ * \brief Get all the items of the buffer as a single contiguous range
+ * \details The items can be removed after being processed with ring_buffer_api_release_front
+ *
+ * \param buffer The buffer handler structure
+ * \param count Where the number of items of the range is stored
+ * \return void * A pointer to the first item, NULL if the buffer handler or
+ *      count are NULL or the buffer is empty
+ */
+void *ring_buffer_mirror_api_front_span(RingBufferHandler_t *buffer, size_t *count);
+
+/*!
+ * \brief Get all the free slots of the buffer as a single contiguous range
+ * \details The written items can be added with ring_buffer_api_commit_back
+ *
+ * \param buffer The buffer handler structure
+ * \param count Where the number of free slots of the range is stored
+ * \return void * A pointer to the first free slot, NULL if the buffer handler
+ *      or count are NULL or the buffer is full
+ */
+void *ring_buffer_mirror_api_back_span(RingBufferHandler_t *buffer, size_t *count);
+
+#endif // __linux__
+
+#endif // RING_BUFFER_MIRROR_API_H
@@ -0,0 +1,98 @@
+/*!
+ * \file ring-buffer-mpmc-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Bounded lock-free multi-producer/multi-consumer ring buffer using an
+ *      arena allocator to dynamically allocate the buffer
+ *
+ * \details The push and pop functions can be called concurrently by any number
+ *      of producers and consumers.
+ *      The state functions can be called by anyone but the returned value
+ *      can be outdated as soon as it is returned.
+ *
+ * \warning The data buffer will not be deallocated automatically but has to be freed
+ *      by using the arena allocator.
+ */
+
+#ifndef RING_BUFFER_MPMC_API_H
+#define RING_BUFFER_MPMC_API_H
+
+#include "ring-buffer-mpmc.h"
+#include "arena-allocator-api.h"
+
+#include <stdbool.h>
+
+/*!
+ * \brief Initialize the lock-free buffer
+ * \details The capacity is rounded up to the next power of two (at least 2)
+ *
+ * \param buffer The buffer handler structure
+ * \param data_size The size of a single item in bytes
+ * \param capacity The minimum number of elements of the buffer
+ * \param arena The arena allocator handler
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the arena are NULL or the allocation fails
+ *     - RING_BUFFER_INVALID_ARGUMENT if the data size is 0 or larger than
+ *       RING_BUFFER_MAX_DATA_SIZE, or the rounded capacity or the size of the
+ *       data don't fit in a size_t
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_mpmc_api_init(
+    RingBufferMpmcHandler_t *buffer,
+    size_t data_size,
+    size_t capacity,
+    ArenaAllocatorHandler_t *arena);
+
+/*!
+ * \brief Get the capacity of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \return size_t The maximum number of elements of the buffer
+ */
+size_t ring_buffer_mpmc_api_capacity(const RingBufferMpmcHandler_t *buffer);
+
+/*!
+ * \brief Check if the buffer is empty
+ *
+ * \param buffer The buffer handler structure
+ * \return True if the buffer is empty, false otherwise
+ */
+bool ring_buffer_mpmc_api_is_empty(const RingBufferMpmcHandler_t *buffer);
+
+/*!
+ * \brief Get the current number of elements in the buffer
+ * \details Items that are being pushed or popped are counted as well
+ *
+ * \param buffer The buffer handler structure
+ * \return size_t The buffer size
+ */
+size_t ring_buffer_mpmc_api_size(const RingBufferMpmcHandler_t *buffer);
+
+/*!
+ * \brief Insert an element at the end of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param item A pointer to the item to insert
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_FULL if the buffer is full
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_mpmc_api_push_back(RingBufferMpmcHandler_t *buffer, const void *item);
+
+/*!
+ * \brief Remove an element from the front of the buffer
+ * \details The 'out' parameter can be NULL
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the removed item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_mpmc_api_pop_front(RingBufferMpmcHandler_t *buffer, void *out);
+
+#endif // RING_BUFFER_MPMC_API_H
@@ -0,0 +1,54 @@
+/*!
+ * \file ring-buffer-mpmc.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Bounded lock-free multi-producer/multi-consumer ring buffer using an
+ *      arena allocator to dynamically allocate the buffer
+ *
+ * \details Every slot of the buffer has a sequence number which tells if the
+ *      slot is ready to be written or read at a given position, producers and
+ *      consumers claim a position with a compare-and-swap on their own index
+ *      and then publish the slot by updating its sequence number, so there is
+ *      no global critical section.
+ *
+ * \warning The data buffer will not be deallocated automatically but has to be freed
+ *      by using the arena allocator.
+ */
+
+#ifndef RING_BUFFER_MPMC_H
+#define RING_BUFFER_MPMC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "ring-buffer.h"
+
+/*!
+ * \brief Structure definition used to pass the lock-free buffer handler as a function parameter
+ * \details The capacity is always a power of two so that the slot index can be
+ *      obtained by masking the free running positions.
+ *      The read-only configuration, the consumers index and the producers
+ *      index are each on their own cache line, so that a push does not
+ *      invalidate the line the consumers are spinning on and vice versa
+ * \attention This structure should not be used directly
+ * \warning If the handler is dynamically allocated the memory must be aligned
+ *      to RING_BUFFER_CACHE_LINE_SIZE (e.g. with aligned_alloc)
+ */
+typedef struct {
+    // Read-only configuration
+    _Alignas(RING_BUFFER_CACHE_LINE_SIZE) size_t mask;
+    uint16_t data_size;
+    atomic_size_t *sequences;
+    void *data;
+
+    // Consumers data
+    _Alignas(RING_BUFFER_CACHE_LINE_SIZE) atomic_size_t head; // Position of the next item to pop, shared by the consumers
+
+    // Producers data
+    _Alignas(RING_BUFFER_CACHE_LINE_SIZE) atomic_size_t tail; // Position of the next item to push, shared by the producers
+} RingBufferMpmcHandler_t;
+
+#endif // RING_BUFFER_MPMC_H
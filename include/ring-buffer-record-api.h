@@ -0,0 +1,155 @@
+/*!
+ * \file ring-buffer-record-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Variable-length record ring buffer (bip-buffer) using an arena
+ *      allocator to dynamically allocate the buffer
+ *
+ * \details Records are written by reserving a contiguous region, filling it in
+ *      place and committing it, and are read in place from the front and then
+ *      released. Only the offsets are updated inside the critical section.
+ *
+ * \warning The data buffer will not be deallocated automatically but has to be freed
+ *      by using the arena allocator.
+ */
+
+#ifndef RING_BUFFER_RECORD_API_H
+#define RING_BUFFER_RECORD_API_H
+
+#include "ring-buffer-record.h"
+#include "ring-buffer-api.h"
+
+#include <stdbool.h>
+
+/*!
+ * \brief Initialize the record buffer
+ * \details The capacity is rounded down to a multiple of RING_BUFFER_RECORD_ALIGNMENT
+ *
+ * \param buffer The buffer handler structure
+ * \param capacity The size of the data in bytes, record headers included
+ * \param cs_enter A pointer to a function that should manage a critical section (can be NULL)
+ * \param cs_exit A pointer to a function that should exit a critical section (can be NULL)
+ * \param arena The arena allocator handler
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the arena are NULL or the allocation fails
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_record_api_init(
+    RingBufferRecordHandler_t *buffer,
+    size_t capacity,
+    void (*cs_enter)(void),
+    void (*cs_exit)(void),
+    ArenaAllocatorHandler_t *arena);
+
+/*!
+ * \brief Check if the buffer is empty
+ *
+ * \param buffer The buffer handler structure
+ * \return True if the buffer is empty, false otherwise
+ */
+bool ring_buffer_record_api_is_empty(RingBufferRecordHandler_t *buffer);
+
+/*!
+ * \brief Get the number of records in the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \return size_t The number of committed records
+ */
+size_t ring_buffer_record_api_size(RingBufferRecordHandler_t *buffer);
+
+/*!
+ * \brief Reserve a contiguous region for a record at the end of the buffer
+ * \details Only one reservation can be pending, a new reservation replaces the
+ *      previous one if it was not committed yet
+ *
+ * \param buffer The buffer handler structure
+ * \param length The maximum length of the record payload in bytes
+ * \param record A pointer to a variable where the address of the payload is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the record are NULL
+ *     - RING_BUFFER_FULL if there is no contiguous free region large enough
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_record_api_reserve(RingBufferRecordHandler_t *buffer, size_t length, void **record);
+
+/*!
+ * \brief Commit the pending reservation making the record visible to the reader
+ * \details The length can be less than the reserved one, in that case the
+ *      remaining space is given back to the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param length The actual length of the record payload in bytes
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_FULL if there is no pending reservation or the length exceeds the reserved one
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_record_api_commit(RingBufferRecordHandler_t *buffer, size_t length);
+
+/*!
+ * \brief Get the record at the front of the buffer without removing it
+ * \details The record stays valid until it is released
+ *
+ * \param buffer The buffer handler structure
+ * \param record A pointer to a variable where the address of the payload is copied into
+ * \param length A pointer to a variable where the length of the payload is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler, the record or the length are NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_record_api_front(RingBufferRecordHandler_t *buffer, const void **record, size_t *length);
+
+/*!
+ * \brief Remove the record at the front of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_record_api_release(RingBufferRecordHandler_t *buffer);
+
+/*!
+ * \brief Copy a record at the end of the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param item A pointer to the payload to copy
+ * \param length The length of the payload in bytes
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_FULL if there is no contiguous free region large enough
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_record_api_push(RingBufferRecordHandler_t *buffer, const void *item, size_t length);
+
+/*!
+ * \brief Copy and remove the record at the front of the buffer
+ * \details The 'out' parameter can be NULL, if the record is longer than
+ *      'size' only the first 'size' bytes are copied
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the payload is copied into
+ * \param size The size of the 'out' variable in bytes
+ * \param length A pointer to a variable where the length of the payload is copied into (can be NULL)
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_record_api_pop(RingBufferRecordHandler_t *buffer, void *out, size_t size, size_t *length);
+
+/*!
+ * \brief Remove all the records and the pending reservation from the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_record_api_clear(RingBufferRecordHandler_t *buffer);
+
+#endif // RING_BUFFER_RECORD_API_H
@@ -0,0 +1,62 @@
+/*!
+ * \file ring-buffer-record.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Variable-length record ring buffer (bip-buffer) using an arena
+ *      allocator to dynamically allocate the buffer
+ *
+ * \details Each record is stored as a length header followed by the payload
+ *      and is always contiguous in memory, so it can be written and read in place.
+ *      When a record does not fit at the end of the buffer it is written at the
+ *      start and the end of the valid data is saved in a watermark.
+ *
+ * \warning The data buffer will not be deallocated automatically but has to be freed
+ *      by using the arena allocator.
+ */
+
+#ifndef RING_BUFFER_RECORD_H
+#define RING_BUFFER_RECORD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring-buffer.h"
+
+/*!
+ * \brief Alignment in bytes of every record and of its payload
+ * \details Must be a power of two, can be overridden at compile time
+ */
+#ifndef RING_BUFFER_RECORD_ALIGNMENT
+#define RING_BUFFER_RECORD_ALIGNMENT (4U)
+#endif // RING_BUFFER_RECORD_ALIGNMENT
+
+/*! \brief Type of the length header stored before each record */
+typedef uint32_t RingBufferRecordLength_t;
+
+/*! \brief Size in bytes of the record header including the alignment padding */
+#define RING_BUFFER_RECORD_HEADER_SIZE \
+    ((sizeof(RingBufferRecordLength_t) + RING_BUFFER_RECORD_ALIGNMENT - 1U) & ~(size_t)(RING_BUFFER_RECORD_ALIGNMENT - 1U))
+
+/*!
+ * \brief Structure definition used to pass the record buffer handler as a function parameter
+ * \details All the offsets are in bytes from the start of the data, when the
+ *      write offset is less than the read offset the valid data goes from the
+ *      read offset to the watermark and then from the start to the write offset
+ * \attention This structure should not be used directly
+ */
+typedef struct {
+    size_t read; // Offset of the first record
+    size_t write; // Offset where the next record is written
+    size_t watermark; // End of the valid data when the write offset has wrapped
+    size_t reserved; // Offset of the pending reservation
+    size_t reserved_size; // Size of the pending reservation, 0 if there is none
+    size_t count; // Number of committed records
+    size_t capacity; // Size of the data in bytes
+    void (*cs_enter)(void);
+    void (*cs_exit)(void);
+    void *data;
+} RingBufferRecordHandler_t;
+
+#endif // RING_BUFFER_RECORD_H
@@ -0,0 +1,155 @@
+/*!
+ * \file ring-buffer-shm-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Single-producer/single-consumer ring buffer placed in a named shared
+ *      memory segment so that it can be used by two different processes
+ *
+ * \details One process creates the buffer and the other one attaches to it
+ *      using the same name, then one of them can push items to the back and
+ *      the other one can pop them from the front without any system call.
+ *
+ * \warning The shared memory segment is not removed when the handlers are
+ *      detached, ring_buffer_shm_api_unlink has to be called when the buffer
+ *      is not needed anymore.
+ */
+
+#ifndef RING_BUFFER_SHM_API_H
+#define RING_BUFFER_SHM_API_H
+
+#ifdef __linux__
+
+#include "ring-buffer-shm.h"
+
+#include <stdbool.h>
+
+/*!
+ * \brief Create a new shared memory segment and initialize the buffer inside it
+ *
+ * \param buffer The buffer handler structure
+ * \param name The name of the shared memory segment (e.g. "/telemetry")
+ * \param data_size The size of a single item in bytes
+ * \param capacity The maximum number of elements of the buffer
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the name are NULL, the
+ *       segment already exists or it cannot be created
+ *     - RING_BUFFER_INVALID_ARGUMENT if the data size or the capacity are 0 or too large
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_shm_api_create(
+    RingBufferShmHandler_t *buffer,
+    const char *name,
+    size_t data_size,
+    size_t capacity);
+
+/*!
+ * \brief Attach to a buffer created by another process
+ * \details The number of slots and the item size are checked against the
+ *      size of the segment and copied into the handler, later changes of the
+ *      shared header are ignored
+ *
+ * \param buffer The buffer handler structure
+ * \param name The name of the shared memory segment
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the name are NULL, the
+ *       segment cannot be opened or its layout is not compatible
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_shm_api_attach(RingBufferShmHandler_t *buffer, const char *name);
+
+/*!
+ * \brief Detach the handler from the shared memory segment
+ * \details The segment and its content are kept until it is unlinked
+ *
+ * \param buffer The buffer handler structure
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL or not attached
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_shm_api_detach(RingBufferShmHandler_t *buffer);
+
+/*!
+ * \brief Remove the name of the shared memory segment
+ * \details The memory is freed once every process has detached from it
+ *
+ * \param name The name of the shared memory segment
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the name is NULL or the segment does not exist
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_shm_api_unlink(const char *name);
+
+/*!
+ * \brief Check if the buffer is empty
+ *
+ * \param buffer The buffer handler structure
+ * \return True if the buffer is empty, false otherwise
+ */
+bool ring_buffer_shm_api_is_empty(const RingBufferShmHandler_t *buffer);
+
+/*!
+ * \brief Get the current number of elements in the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \return size_t The buffer size
+ */
+size_t ring_buffer_shm_api_size(const RingBufferShmHandler_t *buffer);
+
+/*!
+ * \brief Insert an element at the end of the buffer
+ * \attention This function must be called only by the producer process
+ *
+ * \param buffer The buffer handler structure
+ * \param item A pointer to the item to insert
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_FULL if the buffer is full
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_shm_api_push_back(RingBufferShmHandler_t *buffer, const void *item);
+
+/*!
+ * \brief Insert multiple elements at the end of the buffer
+ * \details If there is not enough space only the first items of the array
+ *      that fit are inserted
+ * \attention This function must be called only by the producer process
+ *
+ * \param buffer The buffer handler structure
+ * \param items A pointer to the array of items to insert
+ * \param count The number of items in the array
+ * \return size_t The number of items actually inserted
+ */
+size_t ring_buffer_shm_api_push_back_n(RingBufferShmHandler_t *buffer, const void *items, size_t count);
+
+/*!
+ * \brief Remove an element from the front of the buffer
+ * \details The 'out' parameter can be NULL
+ * \attention This function must be called only by the consumer process
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the removed item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_shm_api_pop_front(RingBufferShmHandler_t *buffer, void *out);
+
+/*!
+ * \brief Remove multiple elements from the front of the buffer
+ * \details The 'out' parameter can be NULL, if the buffer contains less than
+ *      'count' items all of them are removed
+ * \attention This function must be called only by the consumer process
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to an array where the removed items are copied into
+ * \param count The maximum number of items to remove
+ * \return size_t The number of items actually removed
+ */
+size_t ring_buffer_shm_api_pop_front_n(RingBufferShmHandler_t *buffer, void *out, size_t count);
+
+#endif // __linux__
+
+#endif // RING_BUFFER_SHM_API_H
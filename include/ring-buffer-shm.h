@@ -0,0 +1,65 @@
+/*!
+ * \file ring-buffer-shm.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Single-producer/single-consumer ring buffer placed in a named shared
+ *      memory segment so that it can be used by two different processes
+ *
+ * \details The shared memory segment starts with a header with a fixed and
+ *      versioned layout followed by the data. Only fixed width types are used
+ *      so that processes compiled for different ABIs can share the buffer.
+ *      As for the lock-free single-producer/single-consumer buffer the
+ *      indices are published with release/acquire atomic operations.
+ */
+
+#ifndef RING_BUFFER_SHM_H
+#define RING_BUFFER_SHM_H
+
+#ifdef __linux__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "ring-buffer.h"
+
+#define RING_BUFFER_SHM_MAGIC (0x52425348U) // "RBSH"
+#define RING_BUFFER_SHM_VERSION (1U)
+
+/*!
+ * \brief Layout of the header at the start of the shared memory segment
+ * \details The two indices are placed on different cache lines to avoid
+ *      false sharing between the producer and the consumer processes, the
+ *      data starts at 'data_offset' bytes from the start of the segment
+ * \attention This structure should not be used directly
+ */
+typedef struct {
+    _Atomic uint32_t magic;
+    uint32_t version;
+    uint64_t data_size;
+    uint64_t slots;
+    uint64_t data_offset;
+    _Alignas(64) _Atomic uint64_t head; // Index of the first item, written only by the consumer
+    _Alignas(64) _Atomic uint64_t tail; // Index of the first free slot, written only by the producer
+} RingBufferShmHeader_t;
+
+/*!
+ * \brief Structure definition used to pass the shared buffer handler as a function parameter
+ * \details Every process has its own handler which points to the shared segment.
+ *      The layout is validated once when the segment is attached and kept in
+ *      the handler, so that another process can't change it while it is used
+ * \attention This structure should not be used directly
+ */
+typedef struct {
+    RingBufferShmHeader_t *header;
+    void *data;
+    size_t map_size;
+    size_t slots;     // Copy of the validated number of slots
+    size_t data_size; // Copy of the validated item size
+} RingBufferShmHandler_t;
+
+#endif // __linux__
+
+#endif // RING_BUFFER_SHM_H
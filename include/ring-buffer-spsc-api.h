@@ -0,0 +1,177 @@
+/*!
+ * \file ring-buffer-spsc-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Lock-free single-producer/single-consumer ring buffer using an
+ *      arena allocator to dynamically allocate the buffer
+ *
+ * \details The push function can be called only by one producer and the pop
+ *      function only by one consumer, the two of them can run concurrently
+ *      without any lock.
+ *      Every other function can be called by both sides but the returned
+ *      value can be outdated as soon as it is returned.
+ *      Staged items that are not published and read items that are not
+ *      acknowledged are not counted by the state functions.
+ *
+ * \warning The data buffer will not be deallocated automatically but has to be freed
+ *      by using the arena allocator.
+ */
+
+#ifndef RING_BUFFER_SPSC_API_H
+#define RING_BUFFER_SPSC_API_H
+
+#include "ring-buffer-spsc.h"
+#include "arena-allocator-api.h"
+
+#include <stdbool.h>
+
+/*!
+ * \brief Initialize the lock-free buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param data_size The size of a single item in bytes
+ * \param capacity The maximum number of elements of the buffer
+ * \param arena The arena allocator handler
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the arena are NULL or the allocation fails
+ *     - RING_BUFFER_INVALID_ARGUMENT if the data size is 0 or larger than
+ *       RING_BUFFER_MAX_DATA_SIZE, the capacity is 0 or the size of the data
+ *       doesn't fit in a size_t
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_spsc_api_init(
+    RingBufferSpscHandler_t *buffer,
+    size_t data_size,
+    size_t capacity,
+    ArenaAllocatorHandler_t *arena);
+
+/*!
+ * \brief Check if the buffer is empty
+ *
+ * \param buffer The buffer handler structure
+ * \return True if the buffer is empty, false otherwise
+ */
+bool ring_buffer_spsc_api_is_empty(const RingBufferSpscHandler_t *buffer);
+
+/*!
+ * \brief Check if the buffer is full
+ *
+ * \param buffer The buffer handler structure
+ * \return True if the buffer is full, false otherwise
+ */
+bool ring_buffer_spsc_api_is_full(const RingBufferSpscHandler_t *buffer);
+
+/*!
+ * \brief Get the current number of elements in the buffer
+ *
+ * \param buffer The buffer handler structure
+ * \return size_t The buffer size
+ */
+size_t ring_buffer_spsc_api_size(const RingBufferSpscHandler_t *buffer);
+
+/*!
+ * \brief Insert an element at the end of the buffer
+ * \attention This function must be called only by the producer
+ *
+ * \param buffer The buffer handler structure
+ * \param item A pointer to the item to insert
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_FULL if the buffer is full
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_spsc_api_push_back(RingBufferSpscHandler_t *buffer, const void *item);
+
+/*!
+ * \brief Remove an element from the front of the buffer
+ * \details The 'out' parameter can be NULL
+ * \attention This function must be called only by the consumer
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the removed item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if the buffer is empty
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_spsc_api_pop_front(RingBufferSpscHandler_t *buffer, void *out);
+
+/*!
+ * \brief Insert multiple elements at the end of the buffer
+ * \details The items are made visible to the consumer with a single index update,
+ *      if there is not enough space only the first items that fit are inserted
+ * \attention This function must be called only by the producer
+ *
+ * \param buffer The buffer handler structure
+ * \param items A pointer to the array of items to insert
+ * \param count The number of items in the array
+ * \return size_t The number of items actually inserted (0 if the buffer
+ *      handler or the items are NULL)
+ */
+size_t ring_buffer_spsc_api_push_back_n(RingBufferSpscHandler_t *buffer, const void *items, size_t count);
+
+/*!
+ * \brief Remove multiple elements from the front of the buffer
+ * \details The slots are given back to the producer with a single index update,
+ *      the 'out' parameter can be NULL
+ * \attention This function must be called only by the consumer
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to an array where the removed items are copied into
+ * \param count The maximum number of items to remove
+ * \return size_t The number of items actually removed (0 if the buffer
+ *      handler is NULL)
+ */
+size_t ring_buffer_spsc_api_pop_front_n(RingBufferSpscHandler_t *buffer, void *out, size_t count);
+
+/*!
+ * \brief Write an element at the end of the buffer without making it visible to the consumer
+ * \details The staged items are made visible all together by ring_buffer_spsc_api_publish
+ *      (or by any other push function)
+ * \attention This function must be called only by the producer
+ *
+ * \param buffer The buffer handler structure
+ * \param item A pointer to the item to insert
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_FULL if the buffer is full
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_spsc_api_stage_back(RingBufferSpscHandler_t *buffer, const void *item);
+
+/*!
+ * \brief Make all the staged elements visible to the consumer with a single index update
+ * \attention This function must be called only by the producer
+ *
+ * \param buffer The buffer handler structure
+ * \return size_t The number of items published (0 if the buffer handler is NULL)
+ */
+size_t ring_buffer_spsc_api_publish(RingBufferSpscHandler_t *buffer);
+
+/*!
+ * \brief Read an element from the front of the buffer without giving its slot back to the producer
+ * \details The read items are removed all together by ring_buffer_spsc_api_acknowledge
+ *      (or by any other pop function), the 'out' parameter can be NULL
+ * \attention This function must be called only by the consumer
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the item is copied into
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if there are no more items to read
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_spsc_api_read_front(RingBufferSpscHandler_t *buffer, void *out);
+
+/*!
+ * \brief Give back to the producer the slots of all the read elements with a single index update
+ * \attention This function must be called only by the consumer
+ *
+ * \param buffer The buffer handler structure
+ * \return size_t The number of items removed (0 if the buffer handler is NULL)
+ */
+size_t ring_buffer_spsc_api_acknowledge(RingBufferSpscHandler_t *buffer);
+
+#endif // RING_BUFFER_SPSC_API_H
@@ -0,0 +1,60 @@
+/*!
+ * \file ring-buffer-spsc.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Lock-free single-producer/single-consumer ring buffer using an
+ *      arena allocator to dynamically allocate the buffer
+ *
+ * \details This variant of the ring buffer does not use any critical section,
+ *      items can only be pushed to the back by a single producer and popped
+ *      from the front by a single consumer which can run concurrently
+ *      (e.g. two threads or a thread and an interrupt).
+ *      The producer and the consumer each own one index which is published
+ *      to the other side with release/acquire atomic operations.
+ *
+ * \warning The data buffer will not be deallocated automatically but has to be freed
+ *      by using the arena allocator.
+ */
+
+#ifndef RING_BUFFER_SPSC_H
+#define RING_BUFFER_SPSC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "ring-buffer.h"
+
+/*!
+ * \brief Structure definition used to pass the lock-free buffer handler as a function parameter
+ * \details One slot more than the capacity is allocated so that the full and
+ *      empty conditions can be distinguished using only the two indices.
+ *      The read-only configuration, the producer and the consumer data are each
+ *      on their own cache line, every side also keeps a cached copy of the
+ *      other side index which is reloaded only when the buffer looks full (or empty).
+ *      Items can be staged by the producer and read by the consumer without
+ *      moving the shared indices, which are then updated once for the whole batch
+ * \attention This structure should not be used directly
+ * \warning If the handler is dynamically allocated the memory must be aligned
+ *      to RING_BUFFER_CACHE_LINE_SIZE (e.g. with aligned_alloc)
+ */
+typedef struct {
+    // Read-only configuration
+    _Alignas(RING_BUFFER_CACHE_LINE_SIZE) size_t slots;
+    uint16_t data_size;
+    void *data;
+
+    // Producer data
+    _Alignas(RING_BUFFER_CACHE_LINE_SIZE) atomic_size_t tail; // Index of the first free slot, written only by the producer
+    size_t head_cache; // Last value of the head seen by the producer
+    size_t staged; // Number of items written after the tail but not published yet
+
+    // Consumer data
+    _Alignas(RING_BUFFER_CACHE_LINE_SIZE) atomic_size_t head; // Index of the first item, written only by the consumer
+    size_t tail_cache; // Last value of the tail seen by the consumer
+    size_t consumed; // Number of items read after the head but not acknowledged yet
+} RingBufferSpscHandler_t;
+
+#endif // RING_BUFFER_SPSC_H
@@ -0,0 +1,149 @@
+/*!
+ * \file ring-buffer-typed.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Header-only generator of statically allocated ring buffers with a
+ *      fixed item type and capacity
+ *
+ * \details The RING_BUFFER_DEFINE macro declares a structure that contains
+ *      the items array and a set of static inline functions to manage it.
+ *      Since the type and the capacity are known at compile time the copies
+ *      and the index arithmetic can be fully inlined and optimized by the
+ *      compiler, and no arena or runtime initialization is needed: a zero
+ *      initialized structure (e.g. a global or static variable, which is placed
+ *      in .bss) is a valid empty buffer.
+ *
+ *      Example:
+ *      \code
+ *      RING_BUFFER_DEFINE(can_rx, CanFrame, 32)
+ *
+ *      static can_rx_t rx;
+ *
+ *      can_rx_push_back(&rx, &frame);
+ *      can_rx_pop_front(&rx, &frame);
+ *      \endcode
+ *
+ * \attention The generated functions do not use any critical section, the
+ *      caller has to protect them if the buffer is shared with an interrupt
+ *      or another thread
+ */
+
+#ifndef RING_BUFFER_TYPED_H
+#define RING_BUFFER_TYPED_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ring-buffer.h"
+
+/*!
+ * \brief Define a ring buffer type named 'name##_t' and its functions
+ * \details The following functions are generated, with the same behaviour of
+ *      the ring_buffer_api functions with the same suffix:
+ *      - name##_is_empty, name##_is_full, name##_size
+ *      - name##_push_front, name##_push_back
+ *      - name##_pop_front, name##_pop_back
+ *      - name##_front, name##_back
+ *      - name##_peek_front, name##_peek_back
+ *      - name##_clear
+ *
+ * \param name The prefix of the generated type and functions
+ * \param type The type of the items
+ * \param capacity The maximum number of elements of the buffer
+ */
+#define RING_BUFFER_DEFINE(name, type, capacity)                                                   \
+    typedef struct {                                                                               \
+        size_t start;                                                                              \
+        size_t size;                                                                               \
+        type items[(capacity)];                                                                    \
+    } name##_t;                                                                                    \
+                                                                                                   \
+    static inline size_t name##_wrap(size_t index) {                                               \
+        return index >= (capacity) ? index - (capacity) : index;                                   \
+    }                                                                                              \
+    static inline bool name##_is_empty(const name##_t *buffer) {                                   \
+        return buffer == NULL || buffer->size == 0U;                                               \
+    }                                                                                              \
+    static inline bool name##_is_full(const name##_t *buffer) {                                    \
+        return buffer != NULL && buffer->size >= (capacity);                                       \
+    }                                                                                              \
+    static inline size_t name##_size(const name##_t *buffer) {                                     \
+        return buffer == NULL ? 0U : buffer->size;                                                 \
+    }                                                                                              \
+    static inline RingBufferReturnCode name##_push_front(name##_t *buffer, const type *item) {     \
+        if (buffer == NULL || item == NULL)                                                        \
+            return RING_BUFFER_NULL_POINTER;                                                       \
+        if (buffer->size >= (capacity))                                                            \
+            return RING_BUFFER_FULL;                                                               \
+        buffer->start = name##_wrap(buffer->start + (capacity) - 1U);                              \
+        buffer->items[buffer->start] = *item;                                                      \
+        ++buffer->size;                                                                            \
+        return RING_BUFFER_OK;                                                                     \
+    }                                                                                              \
+    static inline RingBufferReturnCode name##_push_back(name##_t *buffer, const type *item) {      \
+        if (buffer == NULL || item == NULL)                                                        \
+            return RING_BUFFER_NULL_POINTER;                                                       \
+        if (buffer->size >= (capacity))                                                            \
+            return RING_BUFFER_FULL;                                                               \
+        buffer->items[name##_wrap(buffer->start + buffer->size)] = *item;                          \
+        ++buffer->size;                                                                            \
+        return RING_BUFFER_OK;                                                                     \
+    }                                                                                              \
+    static inline RingBufferReturnCode name##_pop_front(name##_t *buffer, type *out) {             \
+        if (buffer == NULL)                                                                        \
+            return RING_BUFFER_NULL_POINTER;                                                       \
+        if (buffer->size == 0U)                                                                    \
+            return RING_BUFFER_EMPTY;                                                              \
+        if (out != NULL)                                                                           \
+            *out = buffer->items[buffer->start];                                                   \
+        buffer->start = name##_wrap(buffer->start + 1U);                                           \
+        --buffer->size;                                                                            \
+        return RING_BUFFER_OK;                                                                     \
+    }                                                                                              \
+    static inline RingBufferReturnCode name##_pop_back(name##_t *buffer, type *out) {              \
+        if (buffer == NULL)                                                                        \
+            return RING_BUFFER_NULL_POINTER;                                                       \
+        if (buffer->size == 0U)                                                                    \
+            return RING_BUFFER_EMPTY;                                                              \
+        if (out != NULL)                                                                           \
+            *out = buffer->items[name##_wrap(buffer->start + buffer->size - 1U)];                  \
+        --buffer->size;                                                                            \
+        return RING_BUFFER_OK;                                                                     \
+    }                                                                                              \
+    static inline RingBufferReturnCode name##_front(const name##_t *buffer, type *out) {           \
+        if (buffer == NULL || out == NULL)                                                         \
+            return RING_BUFFER_NULL_POINTER;                                                       \
+        if (buffer->size == 0U)                                                                    \
+            return RING_BUFFER_EMPTY;                                                              \
+        *out = buffer->items[buffer->start];                                                       \
+        return RING_BUFFER_OK;                                                                     \
+    }                                                                                              \
+    static inline RingBufferReturnCode name##_back(const name##_t *buffer, type *out) {            \
+        if (buffer == NULL || out == NULL)                                                         \
+            return RING_BUFFER_NULL_POINTER;                                                       \
+        if (buffer->size == 0U)                                                                    \
+            return RING_BUFFER_EMPTY;                                                              \
+        *out = buffer->items[name##_wrap(buffer->start + buffer->size - 1U)];                      \
+        return RING_BUFFER_OK;                                                                     \
+    }                                                                                              \
+    static inline type *name##_peek_front(name##_t *buffer) {                                      \
+        if (buffer == NULL || buffer->size == 0U)                                                  \
+            return NULL;                                                                           \
+        return &buffer->items[buffer->start];                                                      \
+    }                                                                                              \
+    static inline type *name##_peek_back(name##_t *buffer) {                                       \
+        if (buffer == NULL || buffer->size == 0U)                                                  \
+            return NULL;                                                                           \
+        return &buffer->items[name##_wrap(buffer->start + buffer->size - 1U)];                     \
+    }                                                                                              \
+    static inline RingBufferReturnCode name##_clear(name##_t *buffer) {                            \
+        if (buffer == NULL)                                                                        \
+            return RING_BUFFER_NULL_POINTER;                                                       \
+        buffer->start = 0U;                                                                        \
+        buffer->size = 0U;                                                                         \
+        return RING_BUFFER_OK;                                                                     \
+    }
+
+#endif // RING_BUFFER_TYPED_H
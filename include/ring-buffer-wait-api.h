@@ -0,0 +1,88 @@
+/*!
+ * \file ring-buffer-wait-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Blocking push and pop functions for Linux that wait for free space
+ *      or for items instead of returning immediately
+ *
+ * \details The waiting thread first retries the operation for
+ *      RING_BUFFER_WAIT_SPIN_NS nanoseconds, which keeps the latency low when
+ *      the other side is fast, and then sleeps on a futex until it is woken up
+ *      or the timeout expires.
+ *      Every ring_buffer_api function that adds or removes items wakes up the
+ *      waiting threads, but the futex system call is done only if a thread is
+ *      actually waiting.
+ *      These functions are available only if RING_BUFFER_WAIT is defined at
+ *      compile time for both the library and the application, since it adds
+ *      the futex words to the buffer handler.
+ */
+
+#ifndef RING_BUFFER_WAIT_API_H
+#define RING_BUFFER_WAIT_API_H
+
+#if defined(__linux__) && defined(RING_BUFFER_WAIT)
+
+#include "ring-buffer-api.h"
+
+/*!
+ * \brief Time in nanoseconds spent retrying the operation before sleeping
+ * \details Can be overridden at compile time, 0 disables the spin phase
+ */
+#ifndef RING_BUFFER_WAIT_SPIN_NS
+#define RING_BUFFER_WAIT_SPIN_NS (20000U)
+#endif // RING_BUFFER_WAIT_SPIN_NS
+
+/*!
+ * \brief Remove an element from the front of the buffer waiting until one is available
+ * \details The 'out' parameter can be NULL
+ *
+ * \param buffer The buffer handler structure
+ * \param out A pointer to a variable where the removed item is copied into
+ * \param timeout_ms The maximum time to wait in milliseconds, a negative value waits forever
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler is NULL
+ *     - RING_BUFFER_EMPTY if the buffer is still empty after the timeout
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_pop_front_wait(RingBufferHandler_t *buffer, void *out, int32_t timeout_ms);
+
+/*!
+ * \brief Insert an element at the end of the buffer waiting until there is space for it
+ *
+ * \param buffer The buffer handler structure
+ * \param item A pointer to the item to insert
+ * \param timeout_ms The maximum time to wait in milliseconds, a negative value waits forever
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the buffer handler or the item are NULL
+ *     - RING_BUFFER_FULL if the buffer is still full after the timeout
+ *     - RING_BUFFER_OK otherwise
+ */
+RingBufferReturnCode ring_buffer_api_push_back_wait(RingBufferHandler_t *buffer, void *item, int32_t timeout_ms);
+
+/*!
+ * \brief Wake up the threads waiting for items
+ * \details Called by the ring_buffer_api functions after adding items, the
+ *      system call is done only if a thread is waiting and it wakes at most
+ *      one thread for each added item
+ *
+ * \param buffer The buffer handler structure
+ * \param count The number of added items
+ */
+void ring_buffer_wait_api_notify_items(RingBufferHandler_t *buffer, size_t count);
+
+/*!
+ * \brief Wake up the threads waiting for free space
+ * \details Called by the ring_buffer_api functions after removing items, the
+ *      system call is done only if a thread is waiting and it wakes at most
+ *      one thread for each freed slot
+ *
+ * \param buffer The buffer handler structure
+ * \param count The number of freed slots
+ */
+void ring_buffer_wait_api_notify_space(RingBufferHandler_t *buffer, size_t count);
+
+#endif // __linux__ && RING_BUFFER_WAIT
+
+#endif // RING_BUFFER_WAIT_API_H
@@ -23,8 +23,81 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/*!
+ * \brief Size in bytes of a cache line of the target
+ * \details The indices owned by the producers and by the consumers of the
+ *      lock-free buffers are placed on different cache lines so that they
+ *      don't invalidate each other, can be overridden at compile time (0
+ *      disables the alignment, e.g. for microcontrollers without a data cache)
+ */
+#ifndef RING_BUFFER_CACHE_LINE_SIZE
+#define RING_BUFFER_CACHE_LINE_SIZE (64U)
+#endif // RING_BUFFER_CACHE_LINE_SIZE
+
+/*!
+ * \brief Largest size in bytes of a single item
+ * \details Limited by the data_size field of the buffer handlers, larger
+ *      sizes are rejected during the initialization
+ */
+#define RING_BUFFER_MAX_DATA_SIZE UINT16_MAX
+
+#ifdef RING_BUFFER_WAIT
+#ifndef __linux__
+#error "RING_BUFFER_WAIT is supported only on Linux"
+#endif // __linux__
+#include <stdatomic.h>
+#endif // RING_BUFFER_WAIT
+
+#ifdef RING_BUFFER_EVENT
+#ifndef __linux__
+#error "RING_BUFFER_EVENT is supported only on Linux"
+#endif // __linux__
+#include <stdatomic.h>
+#endif // RING_BUFFER_EVENT
+
+#ifdef RING_BUFFER_STATS
+/*!
+ * \brief Runtime statistics of a buffer
+ * \details The time spent in the critical section is measured only if
+ *      RING_BUFFER_STATS_CLOCK is defined, in the units of that clock
+ */
+typedef struct {
+    uint64_t pushes;       // Number of items added
+    uint64_t pops;         // Number of items removed, not counting the ones removed by clear
+    uint64_t full;         // Number of push operations that could not add all the items
+    uint64_t empty;        // Number of pop operations that could not remove all the items
+    uint64_t overwrites;   // Number of items evicted by ring_buffer_api_push_back_overwrite
+    size_t high_watermark; // Highest size reached by the buffer
+    uint64_t cs_time;      // Total time spent inside the critical section
+} RingBufferStats_t;
+#endif // RING_BUFFER_STATS
+
+/*!
+ * \brief Functions that enter and exit the critical section of a buffer
+ * \details Unlike cs_enter and cs_exit they receive a context pointer, so that
+ *      every buffer can be protected by its own lock
+ */
+typedef struct {
+    void (*enter)(void *ctx);
+    void (*exit)(void *ctx);
+} RingBufferLockPolicy_t;
+
+/*!
+ * \brief Function that copies a single item of the buffer
+ * \details The kernels specialized for an item size ignore the size parameter
+ */
+typedef void (*RingBufferCopy_t)(void *dst, const void *src, size_t size);
+
 /*!
  * \brief Structure definition used to pass the buffer handler as a function parameter
+ * \details If RING_BUFFER_POWER_OF_TWO_CAPACITY is defined at compile time the
+ *      capacity is rounded up to the next power of two during the initialization
+ *      and the indices are wrapped with a mask instead of a compare and subtract.
+ *      If RING_BUFFER_WAIT is defined at compile time the structure also
+ *      contains the futex words used by the blocking functions, and if
+ *      RING_BUFFER_EVENT is defined the event file descriptors.
+ *      If RING_BUFFER_STATS is defined the structure contains the runtime
+ *      statistics, which are updated inside the critical section
  * \attention This function should not be used directly
  */
 typedef struct {
@@ -34,9 +107,50 @@ typedef struct {
     size_t capacity;
     void (*cs_enter)(void);
     void (*cs_exit)(void);
+    const RingBufferLockPolicy_t *lock; // Used instead of cs_enter and cs_exit if not NULL
+    void *lock_ctx;
+    RingBufferCopy_t copy; // Chosen during the initialization based on data_size
     void *data;
+#ifdef RING_BUFFER_WAIT
+    _Atomic uint32_t items_futex; // Changed when items are added while someone is waiting for them
+    _Atomic uint32_t items_waiters;
+    _Atomic uint32_t space_futex; // Changed when items are removed while someone is waiting for free space
+    _Atomic uint32_t space_waiters;
+#endif // RING_BUFFER_WAIT
+#ifdef RING_BUFFER_EVENT
+    int items_fd; // Readable when the buffer is not empty, -1 if not used
+    int space_fd; // Readable when the size is less than the threshold, -1 if not used
+    size_t space_threshold;
+    atomic_bool items_signaled;
+    atomic_bool space_signaled;
+#endif // RING_BUFFER_EVENT
+#ifdef RING_BUFFER_STATS
+    RingBufferStats_t stats;
+    uint64_t stats_cs_start; // Time when the critical section was entered
+#endif // RING_BUFFER_STATS
 } RingBufferHandler_t;
 
+/*!
+ * \brief Function called for each visited item by the for each functions
+ *
+ * \param item A pointer to the item inside the buffer, it can be modified in place
+ * \param index The position of the item from the front of the buffer
+ * \param ctx The context pointer given to the for each function
+ * \return bool True to continue with the next item, false to stop
+ */
+typedef bool (*RingBufferVisitor_t)(void *item, size_t index, void *ctx);
+
+/*!
+ * \brief Cursor used to visit the items of the buffer one at a time
+ * \attention This structure should not be modified directly
+ */
+typedef struct {
+    RingBufferHandler_t *buffer;
+    size_t index;     // Slot of the next item
+    size_t remaining; // Number of items still to visit
+    bool reverse;
+} RingBufferIterator_t;
+
 /*!
  * \brief Enum with all the possible return codes for the ring buffer functions
  */
@@ -44,7 +158,9 @@ typedef enum {
     RING_BUFFER_OK,
     RING_BUFFER_NULL_POINTER,
     RING_BUFFER_EMPTY,
-    RING_BUFFER_FULL
+    RING_BUFFER_FULL,
+    RING_BUFFER_OVERWRITTEN,
+    RING_BUFFER_INVALID_ARGUMENT // A size or a capacity that the buffer cannot represent
 } RingBufferReturnCode;
 
 #endif // RING_BUFFER_H
\ No newline at end of file
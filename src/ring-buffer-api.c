@@ -20,30 +20,387 @@
 
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif // __SSE2__
+
+#ifdef RING_BUFFER_WAIT
+#include "ring-buffer-wait-api.h"
+#endif // RING_BUFFER_WAIT
+#ifdef RING_BUFFER_EVENT
+#include "ring-buffer-event-api.h"
+#endif // RING_BUFFER_EVENT
+
+#if defined(RING_BUFFER_WAIT) || defined(RING_BUFFER_EVENT)
+/*!
+ * \brief Notify the waiting threads and the event file descriptors that items were added
+ *
+ * \param buffer The buffer handler structure
+ * \param count The number of items added
+ */
+static inline void ring_buffer_notify_items(RingBufferHandler_t *buffer, size_t count) {
+    // Nothing changed, the consumers must not be woken up for an empty buffer
+    if (count == 0U)
+        return;
+#ifdef RING_BUFFER_WAIT
+    ring_buffer_wait_api_notify_items(buffer, count);
+#endif // RING_BUFFER_WAIT
+#ifdef RING_BUFFER_EVENT
+    ring_buffer_event_api_notify_items(buffer);
+#endif // RING_BUFFER_EVENT
+    (void)count;
+}
+
+/*!
+ * \brief Notify the waiting threads and the event file descriptors that items were removed
+ *
+ * \param buffer The buffer handler structure
+ * \param count The number of items removed
+ * \param size The number of items left, read inside the critical section of the removal
+ */
+static inline void ring_buffer_notify_space(RingBufferHandler_t *buffer, size_t count, size_t size) {
+    if (count == 0U)
+        return;
+#ifdef RING_BUFFER_WAIT
+    ring_buffer_wait_api_notify_space(buffer, count);
+#endif // RING_BUFFER_WAIT
+#ifdef RING_BUFFER_EVENT
+    ring_buffer_event_api_notify_space(buffer, size);
+#endif // RING_BUFFER_EVENT
+    (void)count;
+    (void)size;
+}
+
+#define RING_BUFFER_NOTIFY_ITEMS(buffer, count) ring_buffer_notify_items(buffer, count)
+#define RING_BUFFER_NOTIFY_SPACE(buffer, count, size) ring_buffer_notify_space(buffer, count, size)
+#else
+#define RING_BUFFER_NOTIFY_ITEMS(buffer, count) ((void)(count))
+#define RING_BUFFER_NOTIFY_SPACE(buffer, count, size) ((void)(count), (void)(size))
+#endif // RING_BUFFER_WAIT || RING_BUFFER_EVENT
+
 void ring_buffer_cs_dummy(void) {
 }
 
-RingBufferReturnCode ring_buffer_api_init(
+/*!
+ * \brief Enter the critical section of the buffer
+ * \details If RING_BUFFER_STATS and RING_BUFFER_STATS_CLOCK are defined the
+ *      time when the critical section is entered is saved
+ *
+ * \param buffer The buffer handler structure
+ */
+static inline void ring_buffer_cs_enter(RingBufferHandler_t *buffer) {
+    ring_buffer_api_lock(buffer);
+#if defined(RING_BUFFER_STATS) && defined(RING_BUFFER_STATS_CLOCK)
+    buffer->stats_cs_start = (uint64_t)RING_BUFFER_STATS_CLOCK();
+#endif // RING_BUFFER_STATS && RING_BUFFER_STATS_CLOCK
+}
+
+/*!
+ * \brief Exit the critical section of the buffer
+ * \details If RING_BUFFER_STATS and RING_BUFFER_STATS_CLOCK are defined the
+ *      time spent in the critical section is added to the statistics
+ *
+ * \param buffer The buffer handler structure
+ */
+static inline void ring_buffer_cs_exit(RingBufferHandler_t *buffer) {
+#if defined(RING_BUFFER_STATS) && defined(RING_BUFFER_STATS_CLOCK)
+    buffer->stats.cs_time += (uint64_t)RING_BUFFER_STATS_CLOCK() - buffer->stats_cs_start;
+#endif // RING_BUFFER_STATS && RING_BUFFER_STATS_CLOCK
+    ring_buffer_api_unlock(buffer);
+}
+
+/*!
+ * \brief Define a copy kernel for items of a fixed size
+ * \details The size is a constant, so the compiler replaces the memcpy with
+ *      fixed width loads and stores instead of calling the generic memcpy
+ */
+#define RING_BUFFER_COPY_KERNEL(bytes)                                                     \
+    static void ring_buffer_copy_##bytes(void *dst, const void *src, size_t size) {        \
+        (void)size;                                                                        \
+        memcpy(dst, src, (bytes));                                                         \
+    }
+
+RING_BUFFER_COPY_KERNEL(1)
+RING_BUFFER_COPY_KERNEL(2)
+RING_BUFFER_COPY_KERNEL(4)
+RING_BUFFER_COPY_KERNEL(8)
+
+#if defined(__SSE2__)
+static void ring_buffer_copy_16(void *dst, const void *src, size_t size) {
+    (void)size;
+    _mm_storeu_si128((__m128i *)dst, _mm_loadu_si128((const __m128i *)src));
+}
+
+static void ring_buffer_copy_32(void *dst, const void *src, size_t size) {
+    (void)size;
+    const __m128i a = _mm_loadu_si128((const __m128i *)src);
+    const __m128i b = _mm_loadu_si128((const __m128i *)src + 1);
+    _mm_storeu_si128((__m128i *)dst, a);
+    _mm_storeu_si128((__m128i *)dst + 1, b);
+}
+
+static void ring_buffer_copy_64(void *dst, const void *src, size_t size) {
+    (void)size;
+    const __m128i a = _mm_loadu_si128((const __m128i *)src);
+    const __m128i b = _mm_loadu_si128((const __m128i *)src + 1);
+    const __m128i c = _mm_loadu_si128((const __m128i *)src + 2);
+    const __m128i d = _mm_loadu_si128((const __m128i *)src + 3);
+    _mm_storeu_si128((__m128i *)dst, a);
+    _mm_storeu_si128((__m128i *)dst + 1, b);
+    _mm_storeu_si128((__m128i *)dst + 2, c);
+    _mm_storeu_si128((__m128i *)dst + 3, d);
+}
+#elif defined(__ARM_NEON)
+static void ring_buffer_copy_16(void *dst, const void *src, size_t size) {
+    (void)size;
+    vst1q_u8((uint8_t *)dst, vld1q_u8((const uint8_t *)src));
+}
+
+static void ring_buffer_copy_32(void *dst, const void *src, size_t size) {
+    (void)size;
+    const uint8x16_t a = vld1q_u8((const uint8_t *)src);
+    const uint8x16_t b = vld1q_u8((const uint8_t *)src + 16);
+    vst1q_u8((uint8_t *)dst, a);
+    vst1q_u8((uint8_t *)dst + 16, b);
+}
+
+static void ring_buffer_copy_64(void *dst, const void *src, size_t size) {
+    (void)size;
+    const uint8x16_t a = vld1q_u8((const uint8_t *)src);
+    const uint8x16_t b = vld1q_u8((const uint8_t *)src + 16);
+    const uint8x16_t c = vld1q_u8((const uint8_t *)src + 32);
+    const uint8x16_t d = vld1q_u8((const uint8_t *)src + 48);
+    vst1q_u8((uint8_t *)dst, a);
+    vst1q_u8((uint8_t *)dst + 16, b);
+    vst1q_u8((uint8_t *)dst + 32, c);
+    vst1q_u8((uint8_t *)dst + 48, d);
+}
+#else
+RING_BUFFER_COPY_KERNEL(16)
+RING_BUFFER_COPY_KERNEL(32)
+RING_BUFFER_COPY_KERNEL(64)
+#endif // __SSE2__
+
+void ring_buffer_api_copy_generic(void *dst, const void *src, size_t size) {
+    memcpy(dst, src, size);
+}
+
+RingBufferCopy_t ring_buffer_api_copy_kernel(size_t data_size) {
+    switch (data_size) {
+        case 1U:
+            return ring_buffer_copy_1;
+        case 2U:
+            return ring_buffer_copy_2;
+        case 4U:
+            return ring_buffer_copy_4;
+        case 8U:
+            return ring_buffer_copy_8;
+        case 16U:
+            return ring_buffer_copy_16;
+        case 32U:
+            return ring_buffer_copy_32;
+        case 64U:
+            return ring_buffer_copy_64;
+        default:
+            return ring_buffer_api_copy_generic;
+    }
+}
+
+/*!
+ * \brief Copy consecutive items from a linear array into the buffer slots
+ * \details The copy is split at the end of the data array so that at most
+ *      two memcpy calls are done
+ *
+ * \param buffer The buffer handler structure
+ * \param index The index of the first slot to write
+ * \param items A pointer to the items to copy
+ * \param count The number of items to copy
+ */
+static void ring_buffer_copy_in(RingBufferHandler_t *buffer, size_t index, const void *items, size_t count) {
+    const size_t data_size = buffer->data_size;
+    uint8_t *base = (uint8_t *)buffer->data;
+    const size_t first = (count < buffer->capacity - index) ? count : buffer->capacity - index;
+    memcpy(base + index * data_size, items, first * data_size);
+    if (count > first)
+        memcpy(base, (const uint8_t *)items + first * data_size, (count - first) * data_size);
+}
+
+/*!
+ * \brief Copy consecutive items from the buffer slots into a linear array
+ * \details The copy is split at the end of the data array so that at most
+ *      two memcpy calls are done
+ *
+ * \param buffer The buffer handler structure
+ * \param index The index of the first slot to read
+ * \param out A pointer to the array where the items are copied into
+ * \param count The number of items to copy
+ */
+static void ring_buffer_copy_out(const RingBufferHandler_t *buffer, size_t index, void *out, size_t count) {
+    const size_t data_size = buffer->data_size;
+    const uint8_t *base = (const uint8_t *)buffer->data;
+    const size_t first = (count < buffer->capacity - index) ? count : buffer->capacity - index;
+    memcpy(out, base + index * data_size, first * data_size);
+    if (count > first)
+        memcpy((uint8_t *)out + first * data_size, base, (count - first) * data_size);
+}
+
+/*!
+ * \brief Split a range of consecutive slots into at most two contiguous segments
+ *
+ * \param buffer The buffer handler structure
+ * \param index The index of the first slot of the range
+ * \param count The number of slots of the range
+ * \param seg1 Where the pointer to the first segment is stored
+ * \param len1 Where the number of items of the first segment is stored
+ * \param seg2 Where the pointer to the second segment is stored (NULL if unused)
+ * \param len2 Where the number of items of the second segment is stored
+ */
+static void ring_buffer_segments(
+    const RingBufferHandler_t *buffer,
+    size_t index,
+    size_t count,
+    void **seg1,
+    size_t *len1,
+    void **seg2,
+    size_t *len2) {
+    uint8_t *base = (uint8_t *)buffer->data;
+    const size_t first = (count < buffer->capacity - index) ? count : buffer->capacity - index;
+    *seg1 = base + index * buffer->data_size;
+    *len1 = first;
+    *seg2 = count > first ? base : NULL;
+    *len2 = count - first;
+}
+
+/*!
+ * \brief Find the first occurrence of a byte in a byte-stream buffer
+ * \details Each contiguous segment is searched with a single memchr call,
+ *      must be called inside the critical section
+ *
+ * \param buffer The buffer handler structure
+ * \param byte The byte to search
+ * \return size_t The position of the byte from the front of the buffer or
+ *      RING_BUFFER_NOT_FOUND
+ */
+static size_t ring_buffer_find_byte(const RingBufferHandler_t *buffer, uint8_t byte) {
+    const uint8_t *base = (const uint8_t *)buffer->data;
+    const size_t to_end = buffer->capacity - buffer->start;
+    const size_t first = buffer->size < to_end ? buffer->size : to_end;
+
+    const uint8_t *found = memchr(base + buffer->start, byte, first);
+    if (found != NULL)
+        return (size_t)(found - (base + buffer->start));
+    found = memchr(base, byte, buffer->size - first);
+    if (found != NULL)
+        return first + (size_t)(found - base);
+    return RING_BUFFER_NOT_FOUND;
+}
+
+/*!
+ * \brief Initialize all the fields of the buffer handler except the data pointer
+ *
+ * \param buffer The buffer handler structure
+ * \param data_size The size of the items
+ * \param capacity The maximum number of elements of the buffer
+ * \param cs_enter A pointer to a function that should manage a critical section (can be NULL)
+ * \param cs_exit A pointer to a function that should exit a critical section (can be NULL)
+ */
+static void ring_buffer_init_fields(
     RingBufferHandler_t *buffer,
     size_t data_size,
     size_t capacity,
     void (*cs_enter)(void),
-    void (*cs_exit)(void),
-    ArenaAllocatorHandler_t *arena) {
-    if (buffer == NULL || arena == NULL)
-        return RING_BUFFER_NULL_POINTER;
+    void (*cs_exit)(void)) {
     buffer->start = 0;
     buffer->size = 0;
-    buffer->data_size = data_size;
+    buffer->data_size = (uint16_t)data_size;
     buffer->capacity = capacity;
     buffer->cs_enter = cs_enter != NULL ? cs_enter : ring_buffer_cs_dummy;
     buffer->cs_exit = cs_exit != NULL ? cs_exit : ring_buffer_cs_dummy;
+    buffer->lock = NULL;
+    buffer->lock_ctx = NULL;
+    buffer->copy = ring_buffer_api_copy_kernel(data_size);
+#ifdef RING_BUFFER_WAIT
+    atomic_init(&buffer->items_futex, 0U);
+    atomic_init(&buffer->items_waiters, 0U);
+    atomic_init(&buffer->space_futex, 0U);
+    atomic_init(&buffer->space_waiters, 0U);
+#endif // RING_BUFFER_WAIT
+#ifdef RING_BUFFER_EVENT
+    buffer->items_fd = -1;
+    buffer->space_fd = -1;
+    buffer->space_threshold = 0U;
+    atomic_init(&buffer->items_signaled, false);
+    atomic_init(&buffer->space_signaled, false);
+#endif // RING_BUFFER_EVENT
+#ifdef RING_BUFFER_STATS
+    memset(&buffer->stats, 0, sizeof(buffer->stats));
+#endif // RING_BUFFER_STATS
+}
+
+RingBufferReturnCode ring_buffer_api_init(
+    RingBufferHandler_t *buffer,
+    size_t data_size,
+    size_t capacity,
+    void (*cs_enter)(void),
+    void (*cs_exit)(void),
+    ArenaAllocatorHandler_t *arena) {
+    if (buffer == NULL || arena == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    if (data_size == 0U || data_size > RING_BUFFER_MAX_DATA_SIZE)
+        return RING_BUFFER_INVALID_ARGUMENT;
+#ifdef RING_BUFFER_POWER_OF_TWO_CAPACITY
+    // Round the capacity up to the next power of two, which must be representable
+    if (capacity > (SIZE_MAX >> 1) + 1U)
+        return RING_BUFFER_INVALID_ARGUMENT;
+    size_t pow2 = 1U;
+    while (pow2 < capacity)
+        pow2 <<= 1U;
+    capacity = pow2;
+#endif // RING_BUFFER_POWER_OF_TWO_CAPACITY
+    if (capacity > SIZE_MAX / data_size)
+        return RING_BUFFER_INVALID_ARGUMENT;
+    ring_buffer_init_fields(buffer, data_size, capacity, cs_enter, cs_exit);
     buffer->data = arena_allocator_api_calloc(arena, data_size, capacity);
     if (buffer->data == NULL)
         return RING_BUFFER_NULL_POINTER;
     return RING_BUFFER_OK;
 }
 
+RingBufferReturnCode ring_buffer_api_init_static(
+    RingBufferHandler_t *buffer,
+    size_t data_size,
+    size_t capacity,
+    void (*cs_enter)(void),
+    void (*cs_exit)(void),
+    void *storage) {
+    if (buffer == NULL || storage == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    if (data_size == 0U || data_size > RING_BUFFER_MAX_DATA_SIZE)
+        return RING_BUFFER_INVALID_ARGUMENT;
+#ifdef RING_BUFFER_POWER_OF_TWO_CAPACITY
+    // Round the capacity down to a power of two since the storage can't grow
+    size_t pow2 = 1U;
+    while (pow2 <= capacity / 2U)
+        pow2 <<= 1U;
+    capacity = capacity == 0U ? 0U : pow2;
+#endif // RING_BUFFER_POWER_OF_TWO_CAPACITY
+    if (capacity > SIZE_MAX / data_size)
+        return RING_BUFFER_INVALID_ARGUMENT;
+    ring_buffer_init_fields(buffer, data_size, capacity, cs_enter, cs_exit);
+    buffer->data = storage;
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_set_lock(RingBufferHandler_t *buffer, const RingBufferLockPolicy_t *policy, void *ctx) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    buffer->lock = policy;
+    buffer->lock_ctx = ctx;
+    return RING_BUFFER_OK;
+}
+
 bool ring_buffer_api_is_empty(const RingBufferHandler_t *buffer) {
     if (buffer == NULL)
         return true;
@@ -66,25 +423,26 @@ RingBufferReturnCode ring_buffer_api_push_front(RingBufferHandler_t *buffer, voi
     if (buffer == NULL || item == NULL)
         return RING_BUFFER_NULL_POINTER;
 
-    buffer->cs_enter();
+    ring_buffer_cs_enter(buffer);
 
     if (buffer->size >= buffer->capacity) {
-        buffer->cs_exit();
+        ring_buffer_api_stats_pushed(buffer, 0U, 1U);
+        ring_buffer_cs_exit(buffer);
         return RING_BUFFER_FULL;
     }
 
     // Calculate index of the item in the buffer
-    if (buffer->start == 0)
-        buffer->start = buffer->capacity;
-    --buffer->start;
+    buffer->start = ring_buffer_api_wrap(buffer, buffer->start + buffer->capacity - 1U);
     ++buffer->size;
 
     // Push item in the buffer
     const size_t data_size = buffer->data_size;
     uint8_t *base = (uint8_t *)buffer->data;
-    memcpy(base + buffer->start * data_size, item, data_size);
+    buffer->copy(base + buffer->start * data_size, item, data_size);
+    ring_buffer_api_stats_pushed(buffer, 1U, 1U);
 
-    buffer->cs_exit();
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_ITEMS(buffer, 1U);
     return RING_BUFFER_OK;
 }
 
@@ -92,25 +450,71 @@ RingBufferReturnCode ring_buffer_api_push_back(RingBufferHandler_t *buffer, void
     if (buffer == NULL || item == NULL)
         return RING_BUFFER_NULL_POINTER;
 
-    buffer->cs_enter();
+    ring_buffer_cs_enter(buffer);
 
     if (buffer->size >= buffer->capacity) {
-        buffer->cs_exit();
+        ring_buffer_api_stats_pushed(buffer, 0U, 1U);
+        ring_buffer_cs_exit(buffer);
         return RING_BUFFER_FULL;
     }
 
     // Calculate index of the item in the buffer
-    size_t cur = buffer->start + buffer->size;
-    if (cur >= buffer->capacity)
-        cur -= buffer->capacity;
+    const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + buffer->size);
 
     // Push item in the buffer
     const size_t data_size = buffer->data_size;
     uint8_t *base = (uint8_t *)buffer->data;
-    memcpy(base + cur * data_size, item, data_size);
+    buffer->copy(base + cur * data_size, item, data_size);
     ++buffer->size;
+    ring_buffer_api_stats_pushed(buffer, 1U, 1U);
 
-    buffer->cs_exit();
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_ITEMS(buffer, 1U);
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_push_back_overwrite(RingBufferHandler_t *buffer, void *item, void *evicted) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    // There is no item to replace
+    if (buffer->capacity == 0U) {
+        ring_buffer_api_stats_pushed(buffer, 0U, 1U);
+        ring_buffer_cs_exit(buffer);
+        return RING_BUFFER_FULL;
+    }
+
+    const size_t data_size = buffer->data_size;
+    uint8_t *base = (uint8_t *)buffer->data;
+    if (buffer->size >= buffer->capacity) {
+        // The oldest item is replaced by the new one and the start moves forward
+        uint8_t *oldest = base + buffer->start * data_size;
+        if (evicted != NULL)
+            buffer->copy(evicted, oldest, data_size);
+        buffer->copy(oldest, item, data_size);
+        buffer->start = ring_buffer_api_wrap(buffer, buffer->start + 1U);
+        ring_buffer_api_stats_pushed(buffer, 1U, 1U);
+#ifdef RING_BUFFER_STATS
+        ++buffer->stats.overwrites;
+#endif // RING_BUFFER_STATS
+
+        ring_buffer_cs_exit(buffer);
+        RING_BUFFER_NOTIFY_ITEMS(buffer, 1U);
+        return RING_BUFFER_OVERWRITTEN;
+    }
+
+    // Calculate index of the item in the buffer
+    const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + buffer->size);
+
+    // Push item in the buffer
+    buffer->copy(base + cur * data_size, item, data_size);
+    ++buffer->size;
+    ring_buffer_api_stats_pushed(buffer, 1U, 1U);
+
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_ITEMS(buffer, 1U);
     return RING_BUFFER_OK;
 }
 
@@ -118,10 +522,11 @@ RingBufferReturnCode ring_buffer_api_pop_front(RingBufferHandler_t *buffer, void
     if (buffer == NULL)
         return RING_BUFFER_NULL_POINTER;
 
-    buffer->cs_enter();
+    ring_buffer_cs_enter(buffer);
 
     if (buffer->size == 0) {
-        buffer->cs_exit();
+        ring_buffer_api_stats_popped(buffer, 0U, 1U);
+        ring_buffer_cs_exit(buffer);
         return RING_BUFFER_EMPTY;
     }
 
@@ -129,16 +534,17 @@ RingBufferReturnCode ring_buffer_api_pop_front(RingBufferHandler_t *buffer, void
     if (out != NULL) {
         const size_t data_size = buffer->data_size;
         uint8_t *base = (uint8_t *)buffer->data;
-        memcpy(out, base + buffer->start * data_size, data_size);
+        buffer->copy(out, base + buffer->start * data_size, data_size);
     }
 
     // Update start and size
-    ++buffer->start;
-    if (buffer->start >= buffer->capacity)
-        buffer->start = 0;
+    buffer->start = ring_buffer_api_wrap(buffer, buffer->start + 1U);
     --buffer->size;
+    ring_buffer_api_stats_popped(buffer, 1U, 1U);
 
-    buffer->cs_exit();
+    const size_t remaining = buffer->size;
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_SPACE(buffer, 1U, remaining);
     return RING_BUFFER_OK;
 }
 
@@ -146,45 +552,401 @@ RingBufferReturnCode ring_buffer_api_pop_back(RingBufferHandler_t *buffer, void
     if (buffer == NULL)
         return RING_BUFFER_NULL_POINTER;
 
-    buffer->cs_enter();
+    ring_buffer_cs_enter(buffer);
 
     if (buffer->size == 0) {
-        buffer->cs_exit();
+        ring_buffer_api_stats_popped(buffer, 0U, 1U);
+        ring_buffer_cs_exit(buffer);
         return RING_BUFFER_EMPTY;
     }
 
     // Pop the item from the buffer
     if (out != NULL) {
-        size_t cur = buffer->start + buffer->size - 1;
-        if (cur >= buffer->capacity)
-            cur -= buffer->capacity;
+        const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + buffer->size - 1);
         const size_t data_size = buffer->data_size;
         uint8_t *base = (uint8_t *)buffer->data;
-        memcpy(out, base + cur * data_size, data_size);
+        buffer->copy(out, base + cur * data_size, data_size);
     }
     --buffer->size;
+    ring_buffer_api_stats_popped(buffer, 1U, 1U);
+
+    const size_t remaining = buffer->size;
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_SPACE(buffer, 1U, remaining);
+    return RING_BUFFER_OK;
+}
+
+size_t ring_buffer_api_push_front_n(RingBufferHandler_t *buffer, const void *items, size_t count) {
+    if (buffer == NULL || items == NULL)
+        return 0U;
+
+    ring_buffer_cs_enter(buffer);
+
+    const size_t available = buffer->capacity - buffer->size;
+    const size_t n = count < available ? count : available;
+
+    // Move the start back by n items and copy them in order
+    buffer->start = ring_buffer_api_wrap(buffer, buffer->start + buffer->capacity - n);
+    ring_buffer_copy_in(buffer, buffer->start, items, n);
+    buffer->size += n;
+    ring_buffer_api_stats_pushed(buffer, n, count);
+
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_ITEMS(buffer, n);
+    return n;
+}
+
+size_t ring_buffer_api_push_back_n(RingBufferHandler_t *buffer, const void *items, size_t count) {
+    if (buffer == NULL || items == NULL)
+        return 0U;
+
+    ring_buffer_cs_enter(buffer);
+
+    const size_t available = buffer->capacity - buffer->size;
+    const size_t n = count < available ? count : available;
+
+    // Calculate index of the first free slot in the buffer
+    const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + buffer->size);
+
+    ring_buffer_copy_in(buffer, cur, items, n);
+    buffer->size += n;
+    ring_buffer_api_stats_pushed(buffer, n, count);
+
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_ITEMS(buffer, n);
+    return n;
+}
+
+size_t ring_buffer_api_pop_front_n(RingBufferHandler_t *buffer, void *out, size_t count) {
+    if (buffer == NULL)
+        return 0U;
+
+    ring_buffer_cs_enter(buffer);
+
+    const size_t n = count < buffer->size ? count : buffer->size;
+    if (out != NULL)
+        ring_buffer_copy_out(buffer, buffer->start, out, n);
+
+    // Update start and size
+    buffer->start = ring_buffer_api_wrap(buffer, buffer->start + n);
+    buffer->size -= n;
+    ring_buffer_api_stats_popped(buffer, n, count);
+
+    const size_t remaining = buffer->size;
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_SPACE(buffer, n, remaining);
+    return n;
+}
+
+size_t ring_buffer_api_pop_back_n(RingBufferHandler_t *buffer, void *out, size_t count) {
+    if (buffer == NULL)
+        return 0U;
+
+    ring_buffer_cs_enter(buffer);
+
+    const size_t n = count < buffer->size ? count : buffer->size;
+    if (out != NULL) {
+        const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + buffer->size - n);
+        ring_buffer_copy_out(buffer, cur, out, n);
+    }
+    buffer->size -= n;
+    ring_buffer_api_stats_popped(buffer, n, count);
+
+    const size_t remaining = buffer->size;
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_SPACE(buffer, n, remaining);
+    return n;
+}
 
-    buffer->cs_exit();
+size_t ring_buffer_api_write(RingBufferHandler_t *buffer, const void *data, size_t length) {
+    if (buffer == NULL || buffer->data_size != 1U)
+        return 0U;
+    return ring_buffer_api_push_back_n(buffer, data, length);
+}
+
+size_t ring_buffer_api_read(RingBufferHandler_t *buffer, void *data, size_t length) {
+    if (buffer == NULL || buffer->data_size != 1U)
+        return 0U;
+    return ring_buffer_api_pop_front_n(buffer, data, length);
+}
+
+size_t ring_buffer_api_find(RingBufferHandler_t *buffer, uint8_t byte) {
+    if (buffer == NULL || buffer->data_size != 1U)
+        return RING_BUFFER_NOT_FOUND;
+
+    ring_buffer_cs_enter(buffer);
+    const size_t position = ring_buffer_find_byte(buffer, byte);
+    ring_buffer_cs_exit(buffer);
+    return position;
+}
+
+size_t ring_buffer_api_read_until(RingBufferHandler_t *buffer, uint8_t delimiter, void *data, size_t length) {
+    if (buffer == NULL || buffer->data_size != 1U)
+        return 0U;
+
+    ring_buffer_cs_enter(buffer);
+
+    const size_t position = ring_buffer_find_byte(buffer, delimiter);
+    if (position == RING_BUFFER_NOT_FOUND || position >= length) {
+        ring_buffer_api_stats_popped(buffer, 0U, 1U);
+        ring_buffer_cs_exit(buffer);
+        return 0U;
+    }
+    const size_t n = position + 1U;
+    if (data != NULL)
+        ring_buffer_copy_out(buffer, buffer->start, data, n);
+
+    // Update start and size
+    buffer->start = ring_buffer_api_wrap(buffer, buffer->start + n);
+    buffer->size -= n;
+    ring_buffer_api_stats_popped(buffer, n, n);
+
+    const size_t remaining = buffer->size;
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_SPACE(buffer, n, remaining);
+    return n;
+}
+
+RingBufferReturnCode ring_buffer_api_acquire_until(
+    RingBufferHandler_t *buffer,
+    uint8_t delimiter,
+    void **seg1,
+    size_t *len1,
+    void **seg2,
+    size_t *len2) {
+    if (buffer == NULL || seg1 == NULL || len1 == NULL || seg2 == NULL || len2 == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    if (buffer->data_size != 1U)
+        return RING_BUFFER_EMPTY;
+
+    ring_buffer_cs_enter(buffer);
+
+    const size_t position = ring_buffer_find_byte(buffer, delimiter);
+    if (position == RING_BUFFER_NOT_FOUND) {
+        ring_buffer_cs_exit(buffer);
+        return RING_BUFFER_EMPTY;
+    }
+    const size_t start = buffer->start;
+
+    ring_buffer_cs_exit(buffer);
+
+    ring_buffer_segments(buffer, start, position + 1U, seg1, len1, seg2, len2);
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_reserve_back(
+    RingBufferHandler_t *buffer,
+    size_t count,
+    void **seg1,
+    size_t *len1,
+    void **seg2,
+    size_t *len2) {
+    if (buffer == NULL || seg1 == NULL || len1 == NULL || seg2 == NULL || len2 == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    if (buffer->size >= buffer->capacity) {
+        ring_buffer_cs_exit(buffer);
+        return RING_BUFFER_FULL;
+    }
+
+    // Calculate index of the first free slot in the buffer
+    const size_t available = buffer->capacity - buffer->size;
+    const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + buffer->size);
+
+    ring_buffer_cs_exit(buffer);
+
+    ring_buffer_segments(buffer, cur, count < available ? count : available, seg1, len1, seg2, len2);
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_commit_back(RingBufferHandler_t *buffer, size_t count) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    if (count > buffer->capacity - buffer->size) {
+        ring_buffer_api_stats_pushed(buffer, 0U, count);
+        ring_buffer_cs_exit(buffer);
+        return RING_BUFFER_FULL;
+    }
+    buffer->size += count;
+    ring_buffer_api_stats_pushed(buffer, count, count);
+
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_ITEMS(buffer, count);
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_acquire_front(
+    RingBufferHandler_t *buffer,
+    size_t count,
+    void **seg1,
+    size_t *len1,
+    void **seg2,
+    size_t *len2) {
+    if (buffer == NULL || seg1 == NULL || len1 == NULL || seg2 == NULL || len2 == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    if (buffer->size == 0) {
+        ring_buffer_cs_exit(buffer);
+        return RING_BUFFER_EMPTY;
+    }
+    const size_t start = buffer->start;
+    const size_t n = count < buffer->size ? count : buffer->size;
+
+    ring_buffer_cs_exit(buffer);
+
+    ring_buffer_segments(buffer, start, n, seg1, len1, seg2, len2);
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_release_front(RingBufferHandler_t *buffer, size_t count) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    if (count > buffer->size) {
+        ring_buffer_api_stats_popped(buffer, 0U, count);
+        ring_buffer_cs_exit(buffer);
+        return RING_BUFFER_EMPTY;
+    }
+
+    // Update start and size
+    buffer->start = ring_buffer_api_wrap(buffer, buffer->start + count);
+    buffer->size -= count;
+    ring_buffer_api_stats_popped(buffer, count, count);
+
+    const size_t remaining = buffer->size;
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_SPACE(buffer, count, remaining);
     return RING_BUFFER_OK;
 }
 
+void *ring_buffer_api_front_span(RingBufferHandler_t *buffer, size_t *count) {
+    if (buffer == NULL || count == NULL)
+        return NULL;
+
+    ring_buffer_cs_enter(buffer);
+
+    // The range stops at the end of the data array
+    const size_t start = buffer->start;
+    const size_t to_end = buffer->capacity - start;
+    *count = buffer->size < to_end ? buffer->size : to_end;
+
+    ring_buffer_cs_exit(buffer);
+    return *count == 0 ? NULL : (uint8_t *)buffer->data + start * buffer->data_size;
+}
+
+void *ring_buffer_api_back_span(RingBufferHandler_t *buffer, size_t *count) {
+    if (buffer == NULL || count == NULL)
+        return NULL;
+
+    ring_buffer_cs_enter(buffer);
+
+    // Calculate index of the first free slot, the range stops at the end of the data array
+    const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + buffer->size);
+    const size_t available = buffer->capacity - buffer->size;
+    const size_t to_end = buffer->capacity - cur;
+    *count = available < to_end ? available : to_end;
+
+    ring_buffer_cs_exit(buffer);
+    return *count == 0 ? NULL : (uint8_t *)buffer->data + cur * buffer->data_size;
+}
+
+/*!
+ * \brief Get a pointer to the slot of the item at a position from the front or from the back
+ * \details Must be called inside the critical section
+ *
+ * \param buffer The buffer handler structure
+ * \param index The position of the item
+ * \param from_back True if the position is counted from the back
+ * \return uint8_t * A pointer to the slot, NULL if the position is out of range
+ */
+static uint8_t *ring_buffer_slot(RingBufferHandler_t *buffer, size_t index, bool from_back) {
+    if (index >= buffer->size)
+        return NULL;
+    return from_back ? ring_buffer_api_at_back_unchecked(buffer, index) : ring_buffer_api_at_unchecked(buffer, index);
+}
+
+RingBufferReturnCode ring_buffer_api_at(RingBufferHandler_t *buffer, size_t index, void *out) {
+    if (buffer == NULL || out == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    const uint8_t *slot = ring_buffer_slot(buffer, index, false);
+    if (slot != NULL)
+        buffer->copy(out, slot, buffer->data_size);
+
+    ring_buffer_cs_exit(buffer);
+    return slot == NULL ? RING_BUFFER_EMPTY : RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_at_back(RingBufferHandler_t *buffer, size_t index, void *out) {
+    if (buffer == NULL || out == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    const uint8_t *slot = ring_buffer_slot(buffer, index, true);
+    if (slot != NULL)
+        buffer->copy(out, slot, buffer->data_size);
+
+    ring_buffer_cs_exit(buffer);
+    return slot == NULL ? RING_BUFFER_EMPTY : RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_set(RingBufferHandler_t *buffer, size_t index, const void *item) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    uint8_t *slot = ring_buffer_slot(buffer, index, false);
+    if (slot != NULL)
+        buffer->copy(slot, item, buffer->data_size);
+
+    ring_buffer_cs_exit(buffer);
+    return slot == NULL ? RING_BUFFER_EMPTY : RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_set_back(RingBufferHandler_t *buffer, size_t index, const void *item) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    uint8_t *slot = ring_buffer_slot(buffer, index, true);
+    if (slot != NULL)
+        buffer->copy(slot, item, buffer->data_size);
+
+    ring_buffer_cs_exit(buffer);
+    return slot == NULL ? RING_BUFFER_EMPTY : RING_BUFFER_OK;
+}
+
 RingBufferReturnCode ring_buffer_api_front(RingBufferHandler_t *buffer, void *out) {
     if (buffer == NULL || out == NULL)
         return RING_BUFFER_NULL_POINTER;
 
-    buffer->cs_enter();
+    ring_buffer_cs_enter(buffer);
 
     if (buffer->size == 0) {
-        buffer->cs_exit();
+        ring_buffer_cs_exit(buffer);
         return RING_BUFFER_EMPTY;
     }
 
     // Copy data
     const size_t data_size = buffer->data_size;
     uint8_t *base = (uint8_t *)buffer->data;
-    memcpy(out, base + buffer->start * data_size, data_size);
+    buffer->copy(out, base + buffer->start * data_size, data_size);
 
-    buffer->cs_exit();
+    ring_buffer_cs_exit(buffer);
     return RING_BUFFER_OK;
 }
 
@@ -192,22 +954,20 @@ RingBufferReturnCode ring_buffer_api_back(RingBufferHandler_t *buffer, void *out
     if (buffer == NULL || out == NULL)
         return RING_BUFFER_NULL_POINTER;
 
-    buffer->cs_enter();
+    ring_buffer_cs_enter(buffer);
 
     if (buffer->size == 0) {
-        buffer->cs_exit();
+        ring_buffer_cs_exit(buffer);
         return RING_BUFFER_EMPTY;
     }
 
     // Copy data
-    size_t cur = buffer->start + buffer->size - 1;
-    if (cur >= buffer->capacity)
-        cur -= buffer->capacity;
+    const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + buffer->size - 1);
     const size_t data_size = buffer->data_size;
     uint8_t *base = (uint8_t *)buffer->data;
-    memcpy(out, base + cur * data_size, data_size);
+    buffer->copy(out, base + cur * data_size, data_size);
 
-    buffer->cs_exit();
+    ring_buffer_cs_exit(buffer);
     return RING_BUFFER_OK;
 }
 
@@ -215,15 +975,15 @@ void *ring_buffer_api_peek_front(RingBufferHandler_t *buffer) {
     if (buffer == NULL)
         return NULL;
 
-    buffer->cs_enter();
+    ring_buffer_cs_enter(buffer);
 
     if (buffer->size == 0) {
-        buffer->cs_exit();
+        ring_buffer_cs_exit(buffer);
         return NULL;
     }
     uint8_t *front = (uint8_t *)buffer->data + buffer->start * buffer->data_size;
 
-    buffer->cs_exit();
+    ring_buffer_cs_exit(buffer);
     return front;
 }
 
@@ -231,29 +991,141 @@ void *ring_buffer_api_peek_back(RingBufferHandler_t *buffer) {
     if (buffer == NULL)
         return NULL;
 
-    buffer->cs_enter();
+    ring_buffer_cs_enter(buffer);
 
     if (buffer->size == 0) {
-        buffer->cs_exit();
+        ring_buffer_cs_exit(buffer);
         return NULL;
     }
 
     // Calculate index of the element in the buffer
-    size_t cur = buffer->start + buffer->size - 1;
-    if (cur >= buffer->capacity)
-        cur -= buffer->capacity;
+    const size_t cur = ring_buffer_api_wrap(buffer, buffer->start + buffer->size - 1);
     uint8_t *back = (uint8_t *)buffer->data + cur * buffer->data_size;
 
-    buffer->cs_exit();
+    ring_buffer_cs_exit(buffer);
     return back;
 }
 
+size_t ring_buffer_api_for_each(RingBufferHandler_t *buffer, RingBufferVisitor_t visitor, void *ctx) {
+    if (buffer == NULL || visitor == NULL)
+        return 0;
+
+    ring_buffer_cs_enter(buffer);
+
+    void *seg[2];
+    size_t len[2];
+    ring_buffer_segments(buffer, buffer->start, buffer->size, &seg[0], &len[0], &seg[1], &len[1]);
+
+    const size_t data_size = buffer->data_size;
+    size_t visited = 0;
+    bool keep_going = true;
+    for (size_t s = 0; s < 2 && keep_going; ++s) {
+        uint8_t *item = (uint8_t *)seg[s];
+        for (size_t i = 0; i < len[s] && keep_going; ++i, item += data_size) {
+            keep_going = visitor(item, visited, ctx);
+            ++visited;
+        }
+    }
+
+    ring_buffer_cs_exit(buffer);
+    return visited;
+}
+
+size_t ring_buffer_api_for_each_reverse(RingBufferHandler_t *buffer, RingBufferVisitor_t visitor, void *ctx) {
+    if (buffer == NULL || visitor == NULL)
+        return 0;
+
+    ring_buffer_cs_enter(buffer);
+
+    void *seg[2];
+    size_t len[2];
+    ring_buffer_segments(buffer, buffer->start, buffer->size, &seg[0], &len[0], &seg[1], &len[1]);
+
+    // Start from the last item of the second segment and go backwards
+    const size_t data_size = buffer->data_size;
+    size_t visited = 0;
+    bool keep_going = true;
+    for (size_t s = 2; s-- > 0 && keep_going;) {
+        if (len[s] == 0)
+            continue;
+        uint8_t *item = (uint8_t *)seg[s] + (len[s] - 1) * data_size;
+        for (size_t i = 0; i < len[s] && keep_going; ++i, item -= data_size) {
+            ++visited;
+            keep_going = visitor(item, buffer->size - visited, ctx);
+        }
+    }
+
+    ring_buffer_cs_exit(buffer);
+    return visited;
+}
+
+RingBufferReturnCode ring_buffer_api_iter_begin(RingBufferHandler_t *buffer, RingBufferIterator_t *it, bool reverse) {
+    if (buffer == NULL || it == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    ring_buffer_cs_enter(buffer);
+
+    it->buffer = buffer;
+    it->remaining = buffer->size;
+    it->reverse = reverse;
+    if (buffer->size == 0)
+        it->index = buffer->start;
+    else
+        it->index = reverse ? ring_buffer_api_wrap(buffer, buffer->start + buffer->size - 1) : buffer->start;
+    return RING_BUFFER_OK;
+}
+
+void *ring_buffer_api_iter_next(RingBufferIterator_t *it) {
+    if (it == NULL || it->remaining == 0)
+        return NULL;
+
+    const RingBufferHandler_t *buffer = it->buffer;
+    uint8_t *item = (uint8_t *)buffer->data + it->index * buffer->data_size;
+    --it->remaining;
+    if (!it->reverse)
+        it->index = ring_buffer_api_wrap(buffer, it->index + 1);
+    else
+        it->index = it->index == 0 ? buffer->capacity - 1 : it->index - 1;
+    return item;
+}
+
+void ring_buffer_api_iter_end(RingBufferIterator_t *it) {
+    if (it == NULL || it->buffer == NULL)
+        return;
+    it->remaining = 0;
+    ring_buffer_cs_exit(it->buffer);
+    it->buffer = NULL;
+}
+
 RingBufferReturnCode ring_buffer_api_clear(RingBufferHandler_t *buffer) {
     if (buffer == NULL)
         return RING_BUFFER_NULL_POINTER;
-    buffer->cs_enter();
+    ring_buffer_cs_enter(buffer);
+    const size_t removed = buffer->size;
     buffer->start = 0;
     buffer->size = 0;
-    buffer->cs_exit();
+    ring_buffer_cs_exit(buffer);
+    RING_BUFFER_NOTIFY_SPACE(buffer, removed, 0U);
     return RING_BUFFER_OK;
-}
\ No newline at end of file
+}
+
+#ifdef RING_BUFFER_STATS
+RingBufferReturnCode ring_buffer_api_stats(RingBufferHandler_t *buffer, RingBufferStats_t *stats) {
+    if (buffer == NULL || stats == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    ring_buffer_api_lock(buffer);
+    *stats = buffer->stats;
+    ring_buffer_api_unlock(buffer);
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_api_stats_reset(RingBufferHandler_t *buffer) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    ring_buffer_api_lock(buffer);
+    memset(&buffer->stats, 0, sizeof(buffer->stats));
+    buffer->stats.high_watermark = buffer->size;
+    ring_buffer_api_unlock(buffer);
+    return RING_BUFFER_OK;
+}
+#endif // RING_BUFFER_STATS
\ No newline at end of file
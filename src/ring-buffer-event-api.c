@@ -0,0 +1,136 @@
+/*!
+ * \file ring-buffer-event-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Event file descriptors for Linux that allow waiting for the buffer
+ *      with poll, select or epoll together with other file descriptors
+ *
+ * \details Each descriptor has a signaled flag, a notifier writes to the
+ *      descriptor only if it is the one that sets the flag. The acknowledge
+ *      functions clear the flag before resetting the descriptor and then check
+ *      the buffer again, so an operation done in the meantime is either seen by
+ *      the check or signals the descriptor by itself and no event is lost.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include "ring-buffer-event-api.h"
+
+#if defined(__linux__) && defined(RING_BUFFER_EVENT)
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+/*!
+ * \brief Write to the descriptor if the flag was not already set
+ *
+ * \param fd The event file descriptor
+ * \param signaled The flag set while the descriptor is readable
+ */
+static void ring_buffer_event_signal(int fd, atomic_bool *signaled) {
+    // Avoid the read-modify-write while the descriptor is already signaled
+    if (atomic_load_explicit(signaled, memory_order_relaxed))
+        return;
+    if (!atomic_exchange_explicit(signaled, true, memory_order_acq_rel))
+        eventfd_write(fd, 1U);
+}
+
+/*!
+ * \brief Get the number of items in the buffer inside the critical section
+ *
+ * \param buffer The buffer handler structure
+ * \return size_t The number of items
+ */
+static size_t ring_buffer_event_size(RingBufferHandler_t *buffer) {
+    ring_buffer_api_lock(buffer);
+    const size_t size = buffer->size;
+    ring_buffer_api_unlock(buffer);
+    return size;
+}
+
+RingBufferReturnCode ring_buffer_event_api_init(RingBufferHandler_t *buffer, size_t space_threshold) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    // Don't leak the descriptors of a previous initialization
+    ring_buffer_event_api_deinit(buffer);
+    buffer->items_fd = eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (buffer->items_fd < 0)
+        return RING_BUFFER_NULL_POINTER;
+    if (space_threshold > 0U) {
+        buffer->space_fd = eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (buffer->space_fd < 0) {
+            ring_buffer_event_api_deinit(buffer);
+            return RING_BUFFER_NULL_POINTER;
+        }
+    }
+    buffer->space_threshold = space_threshold;
+    atomic_store(&buffer->items_signaled, false);
+    atomic_store(&buffer->space_signaled, false);
+
+    const size_t size = ring_buffer_event_size(buffer);
+    if (size > 0U)
+        ring_buffer_event_signal(buffer->items_fd, &buffer->items_signaled);
+    if (buffer->space_fd >= 0 && size < space_threshold)
+        ring_buffer_event_signal(buffer->space_fd, &buffer->space_signaled);
+    return RING_BUFFER_OK;
+}
+
+void ring_buffer_event_api_deinit(RingBufferHandler_t *buffer) {
+    if (buffer == NULL)
+        return;
+    if (buffer->items_fd >= 0)
+        close(buffer->items_fd);
+    if (buffer->space_fd >= 0)
+        close(buffer->space_fd);
+    buffer->items_fd = -1;
+    buffer->space_fd = -1;
+    buffer->space_threshold = 0U;
+}
+
+int ring_buffer_event_api_items_fd(const RingBufferHandler_t *buffer) {
+    return buffer == NULL ? -1 : buffer->items_fd;
+}
+
+int ring_buffer_event_api_space_fd(const RingBufferHandler_t *buffer) {
+    return buffer == NULL ? -1 : buffer->space_fd;
+}
+
+RingBufferReturnCode ring_buffer_event_api_items_ack(RingBufferHandler_t *buffer) {
+    if (buffer == NULL || buffer->items_fd < 0)
+        return RING_BUFFER_NULL_POINTER;
+    atomic_store_explicit(&buffer->items_signaled, false, memory_order_seq_cst);
+    eventfd_t value;
+    eventfd_read(buffer->items_fd, &value);
+    if (ring_buffer_event_size(buffer) == 0U)
+        return RING_BUFFER_EMPTY;
+    ring_buffer_event_signal(buffer->items_fd, &buffer->items_signaled);
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_event_api_space_ack(RingBufferHandler_t *buffer) {
+    if (buffer == NULL || buffer->space_fd < 0)
+        return RING_BUFFER_NULL_POINTER;
+    atomic_store_explicit(&buffer->space_signaled, false, memory_order_seq_cst);
+    eventfd_t value;
+    eventfd_read(buffer->space_fd, &value);
+    if (ring_buffer_event_size(buffer) >= buffer->space_threshold)
+        return RING_BUFFER_FULL;
+    ring_buffer_event_signal(buffer->space_fd, &buffer->space_signaled);
+    return RING_BUFFER_OK;
+}
+
+void ring_buffer_event_api_notify_items(RingBufferHandler_t *buffer) {
+    if (buffer->items_fd >= 0)
+        ring_buffer_event_signal(buffer->items_fd, &buffer->items_signaled);
+}
+
+void ring_buffer_event_api_notify_space(RingBufferHandler_t *buffer, size_t size) {
+    if (buffer->space_fd >= 0 && size < buffer->space_threshold)
+        ring_buffer_event_signal(buffer->space_fd, &buffer->space_signaled);
+}
+
+#endif // __linux__ && RING_BUFFER_EVENT
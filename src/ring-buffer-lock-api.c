@@ -0,0 +1,109 @@
+/*!
+ * \file ring-buffer-lock-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Lock policies that protect each ring buffer with its own lock
+ */
+
+#include "ring-buffer-lock-api.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif // __linux__
+
+/*!
+ * \brief Tell the core that the thread is spinning
+ * \details Reduces the power used while spinning and, on cores with multiple
+ *      hardware threads, gives the execution resources to the other thread.
+ *      On Linux the thread yields the core after RING_BUFFER_LOCK_SPIN_LIMIT
+ *      attempts, since the owner of the lock may have been preempted
+ *
+ * \param spins The number of attempts done so far, incremented by this function
+ */
+static inline void ring_buffer_lock_relax(uint32_t *spins) {
+#ifdef __linux__
+    if (++*spins >= RING_BUFFER_LOCK_SPIN_LIMIT) {
+        *spins = 0U;
+        sched_yield();
+        return;
+    }
+#else
+    (void)spins;
+#endif // __linux__
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7)
+    __asm__ volatile("yield");
+#endif
+}
+
+static void ring_buffer_lock_spinlock_enter(void *ctx) {
+    RingBufferSpinlock_t *lock = (RingBufferSpinlock_t *)ctx;
+    uint32_t spins = 0U;
+    while (atomic_exchange_explicit(&lock->locked, true, memory_order_acquire)) {
+        // Wait with plain loads so that the cache line is not bounced between the cores
+        while (atomic_load_explicit(&lock->locked, memory_order_relaxed))
+            ring_buffer_lock_relax(&spins);
+    }
+}
+
+static void ring_buffer_lock_spinlock_exit(void *ctx) {
+    RingBufferSpinlock_t *lock = (RingBufferSpinlock_t *)ctx;
+    atomic_store_explicit(&lock->locked, false, memory_order_release);
+}
+
+static void ring_buffer_lock_ticket_enter(void *ctx) {
+    RingBufferTicketLock_t *lock = (RingBufferTicketLock_t *)ctx;
+    const unsigned int ticket = atomic_fetch_add_explicit(&lock->next, 1U, memory_order_relaxed);
+    uint32_t spins = 0U;
+    while (atomic_load_explicit(&lock->serving, memory_order_acquire) != ticket)
+        ring_buffer_lock_relax(&spins);
+}
+
+static void ring_buffer_lock_ticket_exit(void *ctx) {
+    RingBufferTicketLock_t *lock = (RingBufferTicketLock_t *)ctx;
+    // Only the owner changes the ticket being served
+    const unsigned int serving = atomic_load_explicit(&lock->serving, memory_order_relaxed);
+    atomic_store_explicit(&lock->serving, serving + 1U, memory_order_release);
+}
+
+const RingBufferLockPolicy_t ring_buffer_lock_spinlock = {
+    .enter = ring_buffer_lock_spinlock_enter,
+    .exit = ring_buffer_lock_spinlock_exit
+};
+
+const RingBufferLockPolicy_t ring_buffer_lock_ticket = {
+    .enter = ring_buffer_lock_ticket_enter,
+    .exit = ring_buffer_lock_ticket_exit
+};
+
+#ifdef __linux__
+static void ring_buffer_lock_pthread_mutex_enter(void *ctx) {
+    pthread_mutex_lock((pthread_mutex_t *)ctx);
+}
+
+static void ring_buffer_lock_pthread_mutex_exit(void *ctx) {
+    pthread_mutex_unlock((pthread_mutex_t *)ctx);
+}
+
+const RingBufferLockPolicy_t ring_buffer_lock_pthread_mutex = {
+    .enter = ring_buffer_lock_pthread_mutex_enter,
+    .exit = ring_buffer_lock_pthread_mutex_exit
+};
+#endif // __linux__
+
+void ring_buffer_lock_api_spinlock_init(RingBufferSpinlock_t *lock) {
+    if (lock == NULL)
+        return;
+    atomic_init(&lock->locked, false);
+}
+
+void ring_buffer_lock_api_ticket_init(RingBufferTicketLock_t *lock) {
+    if (lock == NULL)
+        return;
+    atomic_init(&lock->next, 0U);
+    atomic_init(&lock->serving, 0U);
+}
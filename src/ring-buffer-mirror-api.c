@@ -0,0 +1,135 @@
+/*!
+ * \file ring-buffer-mirror-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Ring buffer backend for Linux where the data is mapped twice
+ *      back-to-back in virtual memory
+ *
+ * \details A region of twice the size of the data is reserved first, then
+ *      the same memory file is mapped over both of its halves.
+ *
+ * \warning The data buffer is not allocated with an arena allocator and has
+ *      to be released with ring_buffer_mirror_api_deinit.
+ */
+
+#ifdef __linux__
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include "ring-buffer-mirror-api.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+RingBufferReturnCode ring_buffer_mirror_api_init(
+    RingBufferHandler_t *buffer,
+    size_t data_size,
+    size_t capacity,
+    void (*cs_enter)(void),
+    void (*cs_exit)(void)) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    if (data_size == 0U || data_size > RING_BUFFER_MAX_DATA_SIZE)
+        return RING_BUFFER_INVALID_ARGUMENT;
+
+    // The capacity must be a multiple of the number of items in lcm(page size, data size) bytes
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t a = page, b = data_size;
+    while (b != 0U) {
+        const size_t r = a % b;
+        a = b;
+        b = r;
+    }
+    const size_t unit = page / a;
+
+    // Both halves of the mapping must fit in the address space after the capacity is rounded up
+    const size_t max_capacity = SIZE_MAX / 2U / data_size;
+    if (max_capacity < unit || capacity > max_capacity - unit)
+        return RING_BUFFER_INVALID_ARGUMENT;
+    if (capacity == 0U)
+        capacity = unit;
+    capacity = (capacity + unit - 1U) / unit * unit;
+#ifdef RING_BUFFER_POWER_OF_TWO_CAPACITY
+    // The unit is a power of two as well so the result is still a multiple of it
+    size_t pow2 = 1U;
+    while (pow2 < capacity)
+        pow2 <<= 1U;
+    capacity = pow2;
+    if (capacity > max_capacity)
+        return RING_BUFFER_INVALID_ARGUMENT;
+#endif // RING_BUFFER_POWER_OF_TWO_CAPACITY
+    const size_t bytes = capacity * data_size;
+
+    int fd = memfd_create("ring-buffer", MFD_CLOEXEC);
+    if (fd < 0)
+        return RING_BUFFER_NULL_POINTER;
+    if (ftruncate(fd, (off_t)bytes) != 0) {
+        close(fd);
+        return RING_BUFFER_NULL_POINTER;
+    }
+
+    // Reserve the address range and map the file over both halves
+    uint8_t *base = mmap(NULL, 2U * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return RING_BUFFER_NULL_POINTER;
+    }
+    if (mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(base + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(base, 2U * bytes);
+        close(fd);
+        return RING_BUFFER_NULL_POINTER;
+    }
+    close(fd);
+
+    // The capacity is already a power of two if needed, so it is not changed
+    const RingBufferReturnCode code = ring_buffer_api_init_static(buffer, data_size, capacity, cs_enter, cs_exit, base);
+    if (code != RING_BUFFER_OK) {
+        munmap(base, 2U * bytes);
+        return code;
+    }
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_mirror_api_deinit(RingBufferHandler_t *buffer) {
+    if (buffer == NULL || buffer->data == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    munmap(buffer->data, 2U * buffer->capacity * buffer->data_size);
+    buffer->data = NULL;
+    buffer->start = 0;
+    buffer->size = 0;
+    return RING_BUFFER_OK;
+}
+
+void *ring_buffer_mirror_api_front_span(RingBufferHandler_t *buffer, size_t *count) {
+    if (buffer == NULL || count == NULL)
+        return NULL;
+
+    ring_buffer_api_lock(buffer);
+
+    *count = buffer->size;
+    uint8_t *front = buffer->size == 0 ? NULL : (uint8_t *)buffer->data + buffer->start * buffer->data_size;
+
+    ring_buffer_api_unlock(buffer);
+    return front;
+}
+
+void *ring_buffer_mirror_api_back_span(RingBufferHandler_t *buffer, size_t *count) {
+    if (buffer == NULL || count == NULL)
+        return NULL;
+
+    ring_buffer_api_lock(buffer);
+
+    // The index of the first free slot can go past the capacity since the data is mirrored
+    *count = buffer->capacity - buffer->size;
+    uint8_t *back = *count == 0 ? NULL : (uint8_t *)buffer->data + (buffer->start + buffer->size) * buffer->data_size;
+
+    ring_buffer_api_unlock(buffer);
+    return back;
+}
+
+#endif // __linux__
@@ -0,0 +1,135 @@
+/*!
+ * \file ring-buffer-mpmc-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Bounded lock-free multi-producer/multi-consumer ring buffer using an
+ *      arena allocator to dynamically allocate the buffer
+ *
+ * \details The slot at position 'pos' is free for a producer when its sequence
+ *      is equal to 'pos' and contains an item for a consumer when its
+ *      sequence is equal to 'pos + 1'. After the pop the sequence is set to
+ *      'pos + capacity' which is the position at which the slot will be
+ *      written during the next round.
+ *
+ * \warning The data buffer will not be deallocated automatically but has to be freed
+ *      by using the arena allocator.
+ */
+
+#include "ring-buffer-mpmc-api.h"
+
+#include <string.h>
+
+RingBufferReturnCode ring_buffer_mpmc_api_init(
+    RingBufferMpmcHandler_t *buffer,
+    size_t data_size,
+    size_t capacity,
+    ArenaAllocatorHandler_t *arena) {
+    if (buffer == NULL || arena == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    if (data_size == 0U || data_size > RING_BUFFER_MAX_DATA_SIZE)
+        return RING_BUFFER_INVALID_ARGUMENT;
+
+    // Round the capacity up to the next power of two, which must be representable
+    if (capacity > (SIZE_MAX >> 1) + 1U)
+        return RING_BUFFER_INVALID_ARGUMENT;
+    size_t slots = 2U;
+    while (slots < capacity)
+        slots <<= 1U;
+    if (slots > SIZE_MAX / sizeof(atomic_size_t) || slots > SIZE_MAX / data_size)
+        return RING_BUFFER_INVALID_ARGUMENT;
+
+    atomic_init(&buffer->head, 0U);
+    atomic_init(&buffer->tail, 0U);
+    buffer->mask = slots - 1U;
+    buffer->data_size = (uint16_t)data_size;
+    buffer->sequences = arena_allocator_api_calloc(arena, sizeof(atomic_size_t), slots);
+    buffer->data = arena_allocator_api_calloc(arena, data_size, slots);
+    if (buffer->sequences == NULL || buffer->data == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    for (size_t i = 0; i < slots; ++i)
+        atomic_init(&buffer->sequences[i], i);
+    return RING_BUFFER_OK;
+}
+
+size_t ring_buffer_mpmc_api_capacity(const RingBufferMpmcHandler_t *buffer) {
+    if (buffer == NULL)
+        return 0U;
+    return buffer->mask + 1U;
+}
+
+bool ring_buffer_mpmc_api_is_empty(const RingBufferMpmcHandler_t *buffer) {
+    return ring_buffer_mpmc_api_size(buffer) == 0U;
+}
+
+size_t ring_buffer_mpmc_api_size(const RingBufferMpmcHandler_t *buffer) {
+    if (buffer == NULL)
+        return 0U;
+    const size_t head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    const size_t tail = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+
+    // The two loads are not done at the same time so the difference can be out of range
+    const size_t size = tail - head;
+    if ((ptrdiff_t)size < 0)
+        return 0U;
+    return size > buffer->mask + 1U ? buffer->mask + 1U : size;
+}
+
+RingBufferReturnCode ring_buffer_mpmc_api_push_back(RingBufferMpmcHandler_t *buffer, const void *item) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    // Claim a position whose slot has already been released by the consumers
+    size_t pos = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+    size_t slot;
+    for (;;) {
+        slot = pos & buffer->mask;
+        const size_t seq = atomic_load_explicit(&buffer->sequences[slot], memory_order_acquire);
+        const ptrdiff_t diff = (ptrdiff_t)(seq - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&buffer->tail, &pos, pos + 1U, memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return RING_BUFFER_FULL;
+        } else {
+            pos = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+        }
+    }
+
+    // Push item in the buffer and publish it to the consumers
+    const size_t data_size = buffer->data_size;
+    memcpy((uint8_t *)buffer->data + slot * data_size, item, data_size);
+    atomic_store_explicit(&buffer->sequences[slot], pos + 1U, memory_order_release);
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_mpmc_api_pop_front(RingBufferMpmcHandler_t *buffer, void *out) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    // Claim a position whose slot has already been published by the producers
+    size_t pos = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    size_t slot;
+    for (;;) {
+        slot = pos & buffer->mask;
+        const size_t seq = atomic_load_explicit(&buffer->sequences[slot], memory_order_acquire);
+        const ptrdiff_t diff = (ptrdiff_t)(seq - (pos + 1U));
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&buffer->head, &pos, pos + 1U, memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return RING_BUFFER_EMPTY;
+        } else {
+            pos = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+        }
+    }
+
+    // Pop the item from the buffer and release the slot for the next round
+    if (out != NULL) {
+        const size_t data_size = buffer->data_size;
+        memcpy(out, (const uint8_t *)buffer->data + slot * data_size, data_size);
+    }
+    atomic_store_explicit(&buffer->sequences[slot], pos + buffer->mask + 1U, memory_order_release);
+    return RING_BUFFER_OK;
+}
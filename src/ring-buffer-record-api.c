@@ -0,0 +1,267 @@
+/*!
+ * \file ring-buffer-record-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Variable-length record ring buffer (bip-buffer) using an arena
+ *      allocator to dynamically allocate the buffer
+ *
+ * \details A record that does not fit between the write offset and the end of
+ *      the data is placed at the start if there is enough room before the read
+ *      offset, the old write offset becomes the watermark where the reader
+ *      has to wrap around.
+ *      The write offset is never allowed to reach the read offset from below
+ *      so that equal offsets always mean that there is no data to read.
+ *
+ * \warning The data buffer will not be deallocated automatically but has to be freed
+ *      by using the arena allocator.
+ */
+
+#include "ring-buffer-record-api.h"
+
+#include <string.h>
+
+/*!
+ * \brief Get the number of bytes used by a record in the buffer
+ *
+ * \param length The length of the record payload in bytes
+ * \return size_t The size of the header plus the aligned payload
+ */
+static inline size_t ring_buffer_record_footprint(size_t length) {
+    return RING_BUFFER_RECORD_HEADER_SIZE + ((length + RING_BUFFER_RECORD_ALIGNMENT - 1U) & ~(size_t)(RING_BUFFER_RECORD_ALIGNMENT - 1U));
+}
+
+/*!
+ * \brief Get the length header of the record at the given offset
+ *
+ * \param buffer The buffer handler structure
+ * \param offset The offset of the record in bytes
+ * \return size_t The length of the record payload in bytes
+ */
+static inline size_t ring_buffer_record_length(const RingBufferRecordHandler_t *buffer, size_t offset) {
+    RingBufferRecordLength_t length;
+    memcpy(&length, (const uint8_t *)buffer->data + offset, sizeof(length));
+    return length;
+}
+
+/*!
+ * \brief Move the read offset to the start if it reached the watermark
+ * \details Must be called inside the critical section every time the read or
+ *      the write offset changes, since the reader can reach the watermark
+ *      before the record that wrapped around is committed
+ *
+ * \param buffer The buffer handler structure
+ */
+static inline void ring_buffer_record_wrap_reader(RingBufferRecordHandler_t *buffer) {
+    if (buffer->write < buffer->read && buffer->read >= buffer->watermark) {
+        buffer->read = 0U;
+        buffer->watermark = buffer->capacity;
+    }
+}
+
+RingBufferReturnCode ring_buffer_record_api_init(
+    RingBufferRecordHandler_t *buffer,
+    size_t capacity,
+    void (*cs_enter)(void),
+    void (*cs_exit)(void),
+    ArenaAllocatorHandler_t *arena) {
+    if (buffer == NULL || arena == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    capacity &= ~(size_t)(RING_BUFFER_RECORD_ALIGNMENT - 1U);
+    buffer->read = 0U;
+    buffer->write = 0U;
+    buffer->watermark = capacity;
+    buffer->reserved = 0U;
+    buffer->reserved_size = 0U;
+    buffer->count = 0U;
+    buffer->capacity = capacity;
+    buffer->cs_enter = cs_enter != NULL ? cs_enter : ring_buffer_cs_dummy;
+    buffer->cs_exit = cs_exit != NULL ? cs_exit : ring_buffer_cs_dummy;
+    buffer->data = arena_allocator_api_calloc(arena, RING_BUFFER_RECORD_ALIGNMENT, capacity / RING_BUFFER_RECORD_ALIGNMENT);
+    if (buffer->data == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    return RING_BUFFER_OK;
+}
+
+bool ring_buffer_record_api_is_empty(RingBufferRecordHandler_t *buffer) {
+    if (buffer == NULL)
+        return true;
+    buffer->cs_enter();
+    bool is_empty = buffer->count == 0U;
+    buffer->cs_exit();
+    return is_empty;
+}
+
+size_t ring_buffer_record_api_size(RingBufferRecordHandler_t *buffer) {
+    if (buffer == NULL)
+        return 0U;
+    buffer->cs_enter();
+    size_t count = buffer->count;
+    buffer->cs_exit();
+    return count;
+}
+
+RingBufferReturnCode ring_buffer_record_api_reserve(RingBufferRecordHandler_t *buffer, size_t length, void **record) {
+    if (buffer == NULL || record == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    // Bound the length before computing the footprint, which would overflow for lengths close to SIZE_MAX
+    if (length > (RingBufferRecordLength_t)-1 || buffer->capacity < RING_BUFFER_RECORD_HEADER_SIZE ||
+        length > buffer->capacity - RING_BUFFER_RECORD_HEADER_SIZE)
+        return RING_BUFFER_FULL;
+
+    const size_t need = ring_buffer_record_footprint(length);
+
+    buffer->cs_enter();
+
+    // Restart from the beginning when there is nothing to read to get the largest contiguous region
+    if (buffer->count == 0U) {
+        buffer->read = 0U;
+        buffer->write = 0U;
+        buffer->watermark = buffer->capacity;
+    }
+
+    const size_t read = buffer->read;
+    const size_t write = buffer->write;
+    size_t offset;
+    if (write >= read) {
+        // Free space goes from the write offset to the end and from the start to the read offset
+        if (buffer->capacity - write >= need)
+            offset = write;
+        else if (need < read)
+            offset = 0U;
+        else {
+            buffer->cs_exit();
+            return RING_BUFFER_FULL;
+        }
+    } else {
+        // Free space goes from the write offset to the read offset
+        if (read - write > need)
+            offset = write;
+        else {
+            buffer->cs_exit();
+            return RING_BUFFER_FULL;
+        }
+    }
+    buffer->reserved = offset;
+    buffer->reserved_size = need;
+
+    buffer->cs_exit();
+
+    *record = (uint8_t *)buffer->data + offset + RING_BUFFER_RECORD_HEADER_SIZE;
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_record_api_commit(RingBufferRecordHandler_t *buffer, size_t length) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    const size_t need = ring_buffer_record_footprint(length);
+
+    buffer->cs_enter();
+
+    if (buffer->reserved_size == 0U || need > buffer->reserved_size) {
+        buffer->cs_exit();
+        return RING_BUFFER_FULL;
+    }
+
+    // Write the header of the record
+    const RingBufferRecordLength_t header = (RingBufferRecordLength_t)length;
+    memcpy((uint8_t *)buffer->data + buffer->reserved, &header, sizeof(header));
+
+    // If the record was placed at the start the reader has to wrap at the old write offset
+    if (buffer->reserved != buffer->write)
+        buffer->watermark = buffer->write;
+    buffer->write = buffer->reserved + need;
+    buffer->reserved_size = 0U;
+    ++buffer->count;
+    ring_buffer_record_wrap_reader(buffer);
+
+    buffer->cs_exit();
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_record_api_front(RingBufferRecordHandler_t *buffer, const void **record, size_t *length) {
+    if (buffer == NULL || record == NULL || length == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    buffer->cs_enter();
+
+    if (buffer->count == 0U) {
+        buffer->cs_exit();
+        return RING_BUFFER_EMPTY;
+    }
+    ring_buffer_record_wrap_reader(buffer);
+    const size_t read = buffer->read;
+
+    buffer->cs_exit();
+
+    *length = ring_buffer_record_length(buffer, read);
+    *record = (const uint8_t *)buffer->data + read + RING_BUFFER_RECORD_HEADER_SIZE;
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_record_api_release(RingBufferRecordHandler_t *buffer) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    buffer->cs_enter();
+
+    if (buffer->count == 0U) {
+        buffer->cs_exit();
+        return RING_BUFFER_EMPTY;
+    }
+    ring_buffer_record_wrap_reader(buffer);
+    buffer->read += ring_buffer_record_footprint(ring_buffer_record_length(buffer, buffer->read));
+    --buffer->count;
+
+    // Wrap the reader around if the end of the valid data is reached
+    ring_buffer_record_wrap_reader(buffer);
+
+    buffer->cs_exit();
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_record_api_push(RingBufferRecordHandler_t *buffer, const void *item, size_t length) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    void *record;
+    RingBufferReturnCode code = ring_buffer_record_api_reserve(buffer, length, &record);
+    if (code != RING_BUFFER_OK)
+        return code;
+    memcpy(record, item, length);
+    return ring_buffer_record_api_commit(buffer, length);
+}
+
+RingBufferReturnCode ring_buffer_record_api_pop(RingBufferRecordHandler_t *buffer, void *out, size_t size, size_t *length) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    const void *record;
+    size_t record_length;
+    RingBufferReturnCode code = ring_buffer_record_api_front(buffer, &record, &record_length);
+    if (code != RING_BUFFER_OK)
+        return code;
+    if (out != NULL)
+        memcpy(out, record, record_length < size ? record_length : size);
+    if (length != NULL)
+        *length = record_length;
+    return ring_buffer_record_api_release(buffer);
+}
+
+RingBufferReturnCode ring_buffer_record_api_clear(RingBufferRecordHandler_t *buffer) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    buffer->cs_enter();
+
+    buffer->read = 0U;
+    buffer->write = 0U;
+    buffer->watermark = buffer->capacity;
+    buffer->reserved_size = 0U;
+    buffer->count = 0U;
+
+    buffer->cs_exit();
+    return RING_BUFFER_OK;
+}
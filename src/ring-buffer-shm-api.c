@@ -0,0 +1,257 @@
+/*!
+ * \file ring-buffer-shm-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Single-producer/single-consumer ring buffer placed in a named shared
+ *      memory segment so that it can be used by two different processes
+ *
+ * \details The magic number is written last with a release store when the
+ *      buffer is created, so a process that attaches and reads it with an
+ *      acquire load always sees a completely initialized header.
+ *
+ * \warning The shared memory segment is not removed when the handlers are
+ *      detached, ring_buffer_shm_api_unlink has to be called when the buffer
+ *      is not needed anymore.
+ */
+
+#ifdef __linux__
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include "ring-buffer-shm-api.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*!
+ * \brief Get the number of items between two indices of the shared buffer
+ *
+ * \param buffer The buffer handler structure
+ * \param head The index of the first item
+ * \param tail The index of the first free slot
+ * \return size_t The number of items
+ */
+static inline size_t ring_buffer_shm_distance(const RingBufferShmHandler_t *buffer, uint64_t head, uint64_t tail) {
+    return (size_t)(tail >= head ? tail - head : buffer->slots - head + tail);
+}
+
+/*!
+ * \brief Map the shared memory segment and set the handler pointers
+ * \details The file descriptor is always closed
+ *
+ * \param buffer The buffer handler structure
+ * \param fd The file descriptor of the shared memory segment
+ * \param map_size The size of the segment in bytes
+ * \return RingBufferReturnCode
+ *     - RING_BUFFER_NULL if the segment cannot be mapped
+ *     - RING_BUFFER_OK otherwise
+ */
+static RingBufferReturnCode ring_buffer_shm_map(RingBufferShmHandler_t *buffer, int fd, size_t map_size) {
+    void *base = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        return RING_BUFFER_NULL_POINTER;
+    buffer->header = (RingBufferShmHeader_t *)base;
+    buffer->map_size = map_size;
+    buffer->data = NULL;
+    buffer->slots = 0U;
+    buffer->data_size = 0U;
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_shm_api_create(
+    RingBufferShmHandler_t *buffer,
+    const char *name,
+    size_t data_size,
+    size_t capacity) {
+    if (buffer == NULL || name == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    if (data_size == 0U)
+        return RING_BUFFER_INVALID_ARGUMENT;
+
+    // The indices must be lock-free to be shared between processes
+    RingBufferShmHeader_t probe;
+    if (!atomic_is_lock_free(&probe.head))
+        return RING_BUFFER_NULL_POINTER;
+
+    // Reject sizes whose mapping would overflow
+    const size_t data_offset = sizeof(RingBufferShmHeader_t);
+    if (capacity == 0U || capacity > (SIZE_MAX - data_offset) / data_size - 1U)
+        return RING_BUFFER_INVALID_ARGUMENT;
+    const size_t slots = capacity + 1U;
+    const size_t map_size = data_offset + slots * data_size;
+
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+        return RING_BUFFER_NULL_POINTER;
+    if (ftruncate(fd, (off_t)map_size) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return RING_BUFFER_NULL_POINTER;
+    }
+    if (ring_buffer_shm_map(buffer, fd, map_size) != RING_BUFFER_OK) {
+        shm_unlink(name);
+        return RING_BUFFER_NULL_POINTER;
+    }
+
+    RingBufferShmHeader_t *header = buffer->header;
+    header->version = RING_BUFFER_SHM_VERSION;
+    header->data_size = data_size;
+    header->slots = slots;
+    header->data_offset = data_offset;
+    atomic_init(&header->head, 0U);
+    atomic_init(&header->tail, 0U);
+    atomic_store_explicit(&header->magic, RING_BUFFER_SHM_MAGIC, memory_order_release);
+
+    buffer->data = (uint8_t *)header + data_offset;
+    buffer->slots = slots;
+    buffer->data_size = data_size;
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_shm_api_attach(RingBufferShmHandler_t *buffer, const char *name) {
+    if (buffer == NULL || name == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0)
+        return RING_BUFFER_NULL_POINTER;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(RingBufferShmHeader_t)) {
+        close(fd);
+        return RING_BUFFER_NULL_POINTER;
+    }
+    if (ring_buffer_shm_map(buffer, fd, (size_t)st.st_size) != RING_BUFFER_OK)
+        return RING_BUFFER_NULL_POINTER;
+
+    // Check that the layout is the one expected by this version of the library
+    const RingBufferShmHeader_t *header = buffer->header;
+    if (atomic_load_explicit(&header->magic, memory_order_acquire) != RING_BUFFER_SHM_MAGIC ||
+        header->version != RING_BUFFER_SHM_VERSION) {
+        ring_buffer_shm_api_detach(buffer);
+        return RING_BUFFER_NULL_POINTER;
+    }
+
+    // The header can be written by any process, so every field is read once and checked against the segment size
+    const uint64_t data_size = header->data_size;
+    const uint64_t slots = header->slots;
+    const uint64_t data_offset = header->data_offset;
+    if (data_size == 0U || slots < 2U ||
+        data_offset < sizeof(RingBufferShmHeader_t) || data_offset > buffer->map_size ||
+        slots > (buffer->map_size - data_offset) / data_size) {
+        ring_buffer_shm_api_detach(buffer);
+        return RING_BUFFER_NULL_POINTER;
+    }
+    buffer->data = (uint8_t *)buffer->header + data_offset;
+    buffer->slots = (size_t)slots;
+    buffer->data_size = (size_t)data_size;
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_shm_api_detach(RingBufferShmHandler_t *buffer) {
+    if (buffer == NULL || buffer->header == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    munmap(buffer->header, buffer->map_size);
+    buffer->header = NULL;
+    buffer->data = NULL;
+    buffer->map_size = 0U;
+    buffer->slots = 0U;
+    buffer->data_size = 0U;
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_shm_api_unlink(const char *name) {
+    if (name == NULL || shm_unlink(name) != 0)
+        return RING_BUFFER_NULL_POINTER;
+    return RING_BUFFER_OK;
+}
+
+bool ring_buffer_shm_api_is_empty(const RingBufferShmHandler_t *buffer) {
+    return ring_buffer_shm_api_size(buffer) == 0U;
+}
+
+size_t ring_buffer_shm_api_size(const RingBufferShmHandler_t *buffer) {
+    if (buffer == NULL || buffer->header == NULL)
+        return 0U;
+    const RingBufferShmHeader_t *header = buffer->header;
+    const uint64_t head = atomic_load_explicit(&header->head, memory_order_acquire);
+    const uint64_t tail = atomic_load_explicit(&header->tail, memory_order_acquire);
+    return ring_buffer_shm_distance(buffer, head, tail);
+}
+
+RingBufferReturnCode ring_buffer_shm_api_push_back(RingBufferShmHandler_t *buffer, const void *item) {
+    if (buffer == NULL || buffer->header == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    return ring_buffer_shm_api_push_back_n(buffer, item, 1U) == 1U ? RING_BUFFER_OK : RING_BUFFER_FULL;
+}
+
+size_t ring_buffer_shm_api_push_back_n(RingBufferShmHandler_t *buffer, const void *items, size_t count) {
+    if (buffer == NULL || buffer->header == NULL || items == NULL)
+        return 0U;
+    RingBufferShmHeader_t *header = buffer->header;
+
+    const uint64_t tail = atomic_load_explicit(&header->tail, memory_order_relaxed);
+    const uint64_t head = atomic_load_explicit(&header->head, memory_order_acquire);
+    if (head >= buffer->slots || tail >= buffer->slots)
+        return 0U;
+    const size_t available = buffer->slots - 1U - ring_buffer_shm_distance(buffer, head, tail);
+    const size_t n = count < available ? count : available;
+
+    // Copy the items splitting them at the end of the data
+    const size_t data_size = buffer->data_size;
+    const size_t first = n < buffer->slots - tail ? n : buffer->slots - tail;
+    uint8_t *base = (uint8_t *)buffer->data;
+    memcpy(base + tail * data_size, items, first * data_size);
+    if (n > first)
+        memcpy(base, (const uint8_t *)items + first * data_size, (n - first) * data_size);
+
+    uint64_t next = tail + n;
+    if (next >= buffer->slots)
+        next -= buffer->slots;
+    atomic_store_explicit(&header->tail, next, memory_order_release);
+    return n;
+}
+
+RingBufferReturnCode ring_buffer_shm_api_pop_front(RingBufferShmHandler_t *buffer, void *out) {
+    if (buffer == NULL || buffer->header == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    return ring_buffer_shm_api_pop_front_n(buffer, out, 1U) == 1U ? RING_BUFFER_OK : RING_BUFFER_EMPTY;
+}
+
+size_t ring_buffer_shm_api_pop_front_n(RingBufferShmHandler_t *buffer, void *out, size_t count) {
+    if (buffer == NULL || buffer->header == NULL)
+        return 0U;
+    RingBufferShmHeader_t *header = buffer->header;
+
+    const uint64_t head = atomic_load_explicit(&header->head, memory_order_relaxed);
+    const uint64_t tail = atomic_load_explicit(&header->tail, memory_order_acquire);
+    if (head >= buffer->slots || tail >= buffer->slots)
+        return 0U;
+    const size_t used = ring_buffer_shm_distance(buffer, head, tail);
+    const size_t n = count < used ? count : used;
+
+    // Copy the items splitting them at the end of the data
+    if (out != NULL) {
+        const size_t data_size = buffer->data_size;
+        const size_t first = n < buffer->slots - head ? n : buffer->slots - head;
+        const uint8_t *base = (const uint8_t *)buffer->data;
+        memcpy(out, base + head * data_size, first * data_size);
+        if (n > first)
+            memcpy((uint8_t *)out + first * data_size, base, (n - first) * data_size);
+    }
+
+    uint64_t next = head + n;
+    if (next >= buffer->slots)
+        next -= buffer->slots;
+    atomic_store_explicit(&header->head, next, memory_order_release);
+    return n;
+}
+
+#endif // __linux__
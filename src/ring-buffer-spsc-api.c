@@ -0,0 +1,285 @@
+/*!
+ * \file ring-buffer-spsc-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Lock-free single-producer/single-consumer ring buffer using an
+ *      arena allocator to dynamically allocate the buffer
+ *
+ * \details The producer reads its own index with a relaxed load, checks the
+ *      consumer index with an acquire load, copies the item and then
+ *      publishes the new index with a release store (and vice versa for the
+ *      consumer), so an item is always completely written before it can be read.
+ *      The index of the other side is cached and reloaded only when needed,
+ *      so in the common case each side touches only its own cache line.
+ *
+ * \warning The data buffer will not be deallocated automatically but has to be freed
+ *      by using the arena allocator.
+ */
+
+#include "ring-buffer-spsc-api.h"
+
+#include <string.h>
+
+RingBufferReturnCode ring_buffer_spsc_api_init(
+    RingBufferSpscHandler_t *buffer,
+    size_t data_size,
+    size_t capacity,
+    ArenaAllocatorHandler_t *arena) {
+    if (buffer == NULL || arena == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    if (data_size == 0U || data_size > RING_BUFFER_MAX_DATA_SIZE)
+        return RING_BUFFER_INVALID_ARGUMENT;
+
+    // One more slot than the capacity is allocated, the data must fit in a size_t
+    if (capacity == 0U || capacity == SIZE_MAX || capacity + 1U > SIZE_MAX / data_size)
+        return RING_BUFFER_INVALID_ARGUMENT;
+    atomic_init(&buffer->head, 0U);
+    atomic_init(&buffer->tail, 0U);
+    buffer->head_cache = 0U;
+    buffer->tail_cache = 0U;
+    buffer->staged = 0U;
+    buffer->consumed = 0U;
+    buffer->slots = capacity + 1U;
+    buffer->data_size = (uint16_t)data_size;
+    buffer->data = arena_allocator_api_calloc(arena, data_size, buffer->slots);
+    if (buffer->data == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    return RING_BUFFER_OK;
+}
+
+bool ring_buffer_spsc_api_is_empty(const RingBufferSpscHandler_t *buffer) {
+    if (buffer == NULL)
+        return true;
+    return atomic_load_explicit(&buffer->head, memory_order_acquire) ==
+        atomic_load_explicit(&buffer->tail, memory_order_acquire);
+}
+
+bool ring_buffer_spsc_api_is_full(const RingBufferSpscHandler_t *buffer) {
+    if (buffer == NULL)
+        return false;
+    return ring_buffer_spsc_api_size(buffer) >= buffer->slots - 1U;
+}
+
+size_t ring_buffer_spsc_api_size(const RingBufferSpscHandler_t *buffer) {
+    if (buffer == NULL)
+        return 0U;
+    const size_t head = atomic_load_explicit(&buffer->head, memory_order_acquire);
+    const size_t tail = atomic_load_explicit(&buffer->tail, memory_order_acquire);
+    return tail >= head ? tail - head : buffer->slots - head + tail;
+}
+
+/*!
+ * \brief Wrap an index of the buffer around the number of slots
+ *
+ * \param buffer The buffer handler structure
+ * \param index The index to wrap, must be less than twice the number of slots
+ * \return size_t The wrapped index
+ */
+static inline size_t ring_buffer_spsc_wrap(const RingBufferSpscHandler_t *buffer, size_t index) {
+    return index >= buffer->slots ? index - buffer->slots : index;
+}
+
+/*!
+ * \brief Get the number of free slots after the given index as seen by the producer
+ * \details The head is loaded (synchronizing with the consumer release) only
+ *      if the cached one says that there are less than 'needed' free slots
+ *
+ * \param buffer The buffer handler structure
+ * \param tail The index of the first slot to write
+ * \param needed The number of slots the producer wants to write
+ * \return size_t The number of free slots
+ */
+static inline size_t ring_buffer_spsc_free(RingBufferSpscHandler_t *buffer, size_t tail, size_t needed) {
+    size_t head = buffer->head_cache;
+    size_t free = (head > tail ? head - tail : buffer->slots - tail + head) - 1U;
+    if (free < needed) {
+        head = atomic_load_explicit(&buffer->head, memory_order_acquire);
+        buffer->head_cache = head;
+        free = (head > tail ? head - tail : buffer->slots - tail + head) - 1U;
+    }
+    return free;
+}
+
+/*!
+ * \brief Get the number of items after the given index as seen by the consumer
+ * \details The tail is loaded (synchronizing with the producer release) only
+ *      if the cached one says that there are less than 'needed' items
+ *
+ * \param buffer The buffer handler structure
+ * \param head The index of the first item to read
+ * \param needed The number of items the consumer wants to read
+ * \return size_t The number of items
+ */
+static inline size_t ring_buffer_spsc_available(RingBufferSpscHandler_t *buffer, size_t head, size_t needed) {
+    size_t tail = buffer->tail_cache;
+    size_t available = tail >= head ? tail - head : buffer->slots - head + tail;
+    if (available < needed) {
+        tail = atomic_load_explicit(&buffer->tail, memory_order_acquire);
+        buffer->tail_cache = tail;
+        available = tail >= head ? tail - head : buffer->slots - head + tail;
+    }
+    return available;
+}
+
+/*!
+ * \brief Copy consecutive items from a linear array into the buffer slots
+ * \details The copy is split at the end of the data array so that at most
+ *      two memcpy calls are done
+ *
+ * \param buffer The buffer handler structure
+ * \param index The index of the first slot to write
+ * \param items A pointer to the items to copy
+ * \param count The number of items to copy
+ */
+static void ring_buffer_spsc_copy_in(RingBufferSpscHandler_t *buffer, size_t index, const void *items, size_t count) {
+    const size_t data_size = buffer->data_size;
+    uint8_t *base = (uint8_t *)buffer->data;
+    const size_t first = (count < buffer->slots - index) ? count : buffer->slots - index;
+    memcpy(base + index * data_size, items, first * data_size);
+    if (count > first)
+        memcpy(base, (const uint8_t *)items + first * data_size, (count - first) * data_size);
+}
+
+/*!
+ * \brief Copy consecutive items from the buffer slots into a linear array
+ * \details The copy is split at the end of the data array so that at most
+ *      two memcpy calls are done
+ *
+ * \param buffer The buffer handler structure
+ * \param index The index of the first slot to read
+ * \param out A pointer to the array where the items are copied into
+ * \param count The number of items to copy
+ */
+static void ring_buffer_spsc_copy_out(const RingBufferSpscHandler_t *buffer, size_t index, void *out, size_t count) {
+    const size_t data_size = buffer->data_size;
+    const uint8_t *base = (const uint8_t *)buffer->data;
+    const size_t first = (count < buffer->slots - index) ? count : buffer->slots - index;
+    memcpy(out, base + index * data_size, first * data_size);
+    if (count > first)
+        memcpy((uint8_t *)out + first * data_size, base, (count - first) * data_size);
+}
+
+RingBufferReturnCode ring_buffer_spsc_api_push_back(RingBufferSpscHandler_t *buffer, const void *item) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    // The tail is written only by the producer so a relaxed load is enough
+    const size_t tail = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+    const size_t cur = ring_buffer_spsc_wrap(buffer, tail + buffer->staged);
+    if (ring_buffer_spsc_free(buffer, cur, 1U) == 0U)
+        return RING_BUFFER_FULL;
+
+    // Push item in the buffer and publish it together with the staged ones
+    ring_buffer_spsc_copy_in(buffer, cur, item, 1U);
+    buffer->staged = 0U;
+    atomic_store_explicit(&buffer->tail, ring_buffer_spsc_wrap(buffer, cur + 1U), memory_order_release);
+    return RING_BUFFER_OK;
+}
+
+RingBufferReturnCode ring_buffer_spsc_api_pop_front(RingBufferSpscHandler_t *buffer, void *out) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    // The head is written only by the consumer so a relaxed load is enough
+    const size_t head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    const size_t cur = ring_buffer_spsc_wrap(buffer, head + buffer->consumed);
+    if (ring_buffer_spsc_available(buffer, cur, 1U) == 0U)
+        return RING_BUFFER_EMPTY;
+
+    // Pop the item from the buffer and release the slot together with the read ones
+    if (out != NULL)
+        ring_buffer_spsc_copy_out(buffer, cur, out, 1U);
+    buffer->consumed = 0U;
+    atomic_store_explicit(&buffer->head, ring_buffer_spsc_wrap(buffer, cur + 1U), memory_order_release);
+    return RING_BUFFER_OK;
+}
+
+size_t ring_buffer_spsc_api_push_back_n(RingBufferSpscHandler_t *buffer, const void *items, size_t count) {
+    if (buffer == NULL || items == NULL)
+        return 0U;
+
+    const size_t tail = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+    const size_t cur = ring_buffer_spsc_wrap(buffer, tail + buffer->staged);
+    const size_t free = ring_buffer_spsc_free(buffer, cur, count);
+    const size_t n = count < free ? count : free;
+
+    ring_buffer_spsc_copy_in(buffer, cur, items, n);
+    buffer->staged = 0U;
+    atomic_store_explicit(&buffer->tail, ring_buffer_spsc_wrap(buffer, cur + n), memory_order_release);
+    return n;
+}
+
+size_t ring_buffer_spsc_api_pop_front_n(RingBufferSpscHandler_t *buffer, void *out, size_t count) {
+    if (buffer == NULL)
+        return 0U;
+
+    const size_t head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    const size_t cur = ring_buffer_spsc_wrap(buffer, head + buffer->consumed);
+    const size_t available = ring_buffer_spsc_available(buffer, cur, count);
+    const size_t n = count < available ? count : available;
+
+    if (out != NULL)
+        ring_buffer_spsc_copy_out(buffer, cur, out, n);
+    buffer->consumed = 0U;
+    atomic_store_explicit(&buffer->head, ring_buffer_spsc_wrap(buffer, cur + n), memory_order_release);
+    return n;
+}
+
+RingBufferReturnCode ring_buffer_spsc_api_stage_back(RingBufferSpscHandler_t *buffer, const void *item) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    const size_t tail = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+    const size_t cur = ring_buffer_spsc_wrap(buffer, tail + buffer->staged);
+    if (ring_buffer_spsc_free(buffer, cur, 1U) == 0U)
+        return RING_BUFFER_FULL;
+
+    // The item is written but the tail is not moved
+    ring_buffer_spsc_copy_in(buffer, cur, item, 1U);
+    ++buffer->staged;
+    return RING_BUFFER_OK;
+}
+
+size_t ring_buffer_spsc_api_publish(RingBufferSpscHandler_t *buffer) {
+    if (buffer == NULL)
+        return 0U;
+
+    const size_t staged = buffer->staged;
+    if (staged == 0U)
+        return 0U;
+    const size_t tail = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+    buffer->staged = 0U;
+    atomic_store_explicit(&buffer->tail, ring_buffer_spsc_wrap(buffer, tail + staged), memory_order_release);
+    return staged;
+}
+
+RingBufferReturnCode ring_buffer_spsc_api_read_front(RingBufferSpscHandler_t *buffer, void *out) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+
+    const size_t head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    const size_t cur = ring_buffer_spsc_wrap(buffer, head + buffer->consumed);
+    if (ring_buffer_spsc_available(buffer, cur, 1U) == 0U)
+        return RING_BUFFER_EMPTY;
+
+    // The item is read but the head is not moved so the slot can not be overwritten yet
+    if (out != NULL)
+        ring_buffer_spsc_copy_out(buffer, cur, out, 1U);
+    ++buffer->consumed;
+    return RING_BUFFER_OK;
+}
+
+size_t ring_buffer_spsc_api_acknowledge(RingBufferSpscHandler_t *buffer) {
+    if (buffer == NULL)
+        return 0U;
+
+    const size_t consumed = buffer->consumed;
+    if (consumed == 0U)
+        return 0U;
+    const size_t head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    buffer->consumed = 0U;
+    atomic_store_explicit(&buffer->head, ring_buffer_spsc_wrap(buffer, head + consumed), memory_order_release);
+    return consumed;
+}
@@ -0,0 +1,143 @@
+/*!
+ * \file ring-buffer-wait-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Blocking push and pop functions for Linux that wait for free space
+ *      or for items instead of returning immediately
+ *
+ * \details A waiter registers itself in the waiters counter, reads the futex
+ *      word, retries the operation and then sleeps only if the futex word is
+ *      still the same. A notifier changes the futex word and wakes the waiters
+ *      only if the counter is not zero, both sides use sequentially consistent
+ *      operations so that either the waiter sees the new state of the buffer
+ *      or the notifier sees the registered waiter.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include "ring-buffer-wait-api.h"
+
+#if defined(__linux__) && defined(RING_BUFFER_WAIT)
+
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+/*!
+ * \brief Get the current value of the monotonic clock
+ *
+ * \return int64_t The time in nanoseconds
+ */
+static int64_t ring_buffer_wait_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+/*!
+ * \brief Wake up the threads sleeping on a futex word if there are any
+ * \details At most 'count' threads are woken so that a single item or slot
+ *      does not wake every waiting thread just to have all but one of them
+ *      go back to sleep
+ *
+ * \param futex The futex word
+ * \param waiters The number of registered waiters
+ * \param count The maximum number of threads to wake
+ */
+static void ring_buffer_wait_wake(_Atomic uint32_t *futex, _Atomic uint32_t *waiters, size_t count) {
+    if (count == 0U)
+        return;
+    // Order the changes of the buffer before the read of the waiters counter
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiters, memory_order_relaxed) == 0U)
+        return;
+    atomic_fetch_add_explicit(futex, 1U, memory_order_seq_cst);
+    const int wake = count > (size_t)INT_MAX ? INT_MAX : (int)count;
+    syscall(SYS_futex, (uint32_t *)futex, FUTEX_WAKE_PRIVATE, wake, NULL, NULL, 0);
+}
+
+/*!
+ * \brief Retry an operation until it succeeds or the timeout expires
+ *
+ * \param buffer The buffer handler structure
+ * \param op The push or pop function to retry
+ * \param arg The item passed to the function
+ * \param busy The return code of the function when it has to be retried
+ * \param futex The futex word changed when the operation can succeed
+ * \param waiters The number of registered waiters on the futex word
+ * \param timeout_ms The maximum time to wait in milliseconds, negative to wait forever
+ * \return RingBufferReturnCode The last return code of the operation
+ */
+static RingBufferReturnCode ring_buffer_wait(
+    RingBufferHandler_t *buffer,
+    RingBufferReturnCode (*op)(RingBufferHandler_t *, void *),
+    void *arg,
+    RingBufferReturnCode busy,
+    _Atomic uint32_t *futex,
+    _Atomic uint32_t *waiters,
+    int32_t timeout_ms) {
+    RingBufferReturnCode code = op(buffer, arg);
+    if (code != busy || timeout_ms == 0)
+        return code;
+
+    const int64_t start = ring_buffer_wait_now_ns();
+    const int64_t deadline = timeout_ms < 0 ? INT64_MAX : start + (int64_t)timeout_ms * 1000000LL;
+
+    // Spin for a short time since the other side is probably about to run
+    while (ring_buffer_wait_now_ns() - start < (int64_t)RING_BUFFER_WAIT_SPIN_NS) {
+        code = op(buffer, arg);
+        if (code != busy)
+            return code;
+    }
+
+    // Park the thread on the futex
+    for (;;) {
+        atomic_fetch_add_explicit(waiters, 1U, memory_order_seq_cst);
+        const uint32_t seq = atomic_load_explicit(futex, memory_order_seq_cst);
+        code = op(buffer, arg);
+        const int64_t now = ring_buffer_wait_now_ns();
+        if (code != busy || now >= deadline) {
+            atomic_fetch_sub_explicit(waiters, 1U, memory_order_relaxed);
+            return code;
+        }
+
+        struct timespec remaining;
+        struct timespec *timeout = NULL;
+        if (deadline != INT64_MAX) {
+            remaining.tv_sec = (time_t)((deadline - now) / 1000000000LL);
+            remaining.tv_nsec = (long)((deadline - now) % 1000000000LL);
+            timeout = &remaining;
+        }
+        // Returns immediately if the futex word was changed after it was read
+        syscall(SYS_futex, (uint32_t *)futex, FUTEX_WAIT_PRIVATE, seq, timeout, NULL, 0);
+        atomic_fetch_sub_explicit(waiters, 1U, memory_order_relaxed);
+    }
+}
+
+RingBufferReturnCode ring_buffer_api_pop_front_wait(RingBufferHandler_t *buffer, void *out, int32_t timeout_ms) {
+    if (buffer == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    return ring_buffer_wait(buffer, ring_buffer_api_pop_front, out, RING_BUFFER_EMPTY, &buffer->items_futex, &buffer->items_waiters, timeout_ms);
+}
+
+RingBufferReturnCode ring_buffer_api_push_back_wait(RingBufferHandler_t *buffer, void *item, int32_t timeout_ms) {
+    if (buffer == NULL || item == NULL)
+        return RING_BUFFER_NULL_POINTER;
+    return ring_buffer_wait(buffer, ring_buffer_api_push_back, item, RING_BUFFER_FULL, &buffer->space_futex, &buffer->space_waiters, timeout_ms);
+}
+
+void ring_buffer_wait_api_notify_items(RingBufferHandler_t *buffer, size_t count) {
+    ring_buffer_wait_wake(&buffer->items_futex, &buffer->items_waiters, count);
+}
+
+void ring_buffer_wait_api_notify_space(RingBufferHandler_t *buffer, size_t count) {
+    ring_buffer_wait_wake(&buffer->space_futex, &buffer->space_waiters, count);
+}
+
+#endif // __linux__ && RING_BUFFER_WAIT
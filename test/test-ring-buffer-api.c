@@ -20,6 +20,7 @@
 #include "ring-buffer-api.h"
 
 #include <stdio.h>
+#include <string.h>
 
 typedef struct {
     float x, y;
@@ -27,6 +28,7 @@ typedef struct {
 
 RingBufferHandler_t int_buf;
 RingBufferHandler_t point_buf;
+RingBufferHandler_t byte_buf;
 ArenaAllocatorHandler_t arena;
 
 void cs_enter(void) {
@@ -41,11 +43,13 @@ void setUp(void) {
     arena_allocator_api_init(&arena);
     ring_buffer_api_init(&int_buf, sizeof(int), 10, NULL, NULL, &arena);
     ring_buffer_api_init(&point_buf, sizeof(Point), 10, NULL, NULL, &arena);
+    ring_buffer_api_init(&byte_buf, sizeof(uint8_t), 10, NULL, NULL, &arena);
 }
 
 void tearDown(void) {
     ring_buffer_api_clear(&int_buf);
     ring_buffer_api_clear(&point_buf);
+    ring_buffer_api_clear(&byte_buf);
     arena_allocator_api_free(&arena);
 }
 
@@ -65,6 +69,28 @@ void check_ring_buffer_init_defined_cs_function(void) {
     RingBufferHandler_t buf;
     TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_init(&buf, sizeof(float), 3, cs_enter, cs_exit, &arena));
 }
+void check_ring_buffer_init_capacity(void) {
+    RingBufferHandler_t buf;
+    ring_buffer_api_init(&buf, sizeof(float), 5, NULL, NULL, &arena);
+#ifdef RING_BUFFER_POWER_OF_TWO_CAPACITY
+    TEST_ASSERT_EQUAL_size_t(8U, buf.capacity);
+#else
+    TEST_ASSERT_EQUAL_size_t(5U, buf.capacity);
+#endif // RING_BUFFER_POWER_OF_TWO_CAPACITY
+}
+void check_ring_buffer_init_capacity_too_large(void) {
+    RingBufferHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_api_init(&buf, sizeof(int), SIZE_MAX, NULL, NULL, &arena));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_api_init(&buf, sizeof(int), (SIZE_MAX >> 1) + 2U, NULL, NULL, &arena));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_api_init(&buf, sizeof(int), SIZE_MAX / sizeof(int) + 1U, NULL, NULL, &arena));
+}
+void check_ring_buffer_init_invalid_data_size(void) {
+    RingBufferHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_api_init(&buf, 0U, 3, NULL, NULL, &arena));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_api_init(&buf, RING_BUFFER_MAX_DATA_SIZE + 1U, 3, NULL, NULL, &arena));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_init(&buf, RING_BUFFER_MAX_DATA_SIZE, 1, NULL, NULL, &arena));
+    TEST_ASSERT_EQUAL_size_t(RING_BUFFER_MAX_DATA_SIZE, buf.data_size);
+}
 
 /*! @} */
 
@@ -617,6 +643,1002 @@ void check_ring_buffer_clear_size(void) {
 
 /*! @} */
 
+/*! 
+ * \defgroup ring_buffer_push_front_n Test ring buffer push front n function
+ * @{
+ */
+
+void check_ring_buffer_push_front_n_with_null_handler(void) {
+    int items[3] = { 1, 2, 3 };
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_push_front_n(NULL, items, 3));
+}
+void check_ring_buffer_push_front_n_with_null_items(void) {
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_push_front_n(&int_buf, NULL, 3));
+}
+void check_ring_buffer_push_front_n_when_full(void) {
+    int items[3] = { 1, 2, 3 };
+    int_buf.size = int_buf.capacity;
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_push_front_n(&int_buf, items, 3));
+}
+void check_ring_buffer_push_front_n_partial(void) {
+    int items[3] = { 1, 2, 3 };
+    int_buf.size = int_buf.capacity - 2;
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_api_push_front_n(&int_buf, items, 3));
+    TEST_ASSERT_EQUAL_size_t(int_buf.capacity, int_buf.size);
+}
+void check_ring_buffer_push_front_n_with_wrap_data(void) {
+    int items[3] = { 1, 2, 3 };
+    int_buf.start = 1;
+    ring_buffer_api_push_front_n(&int_buf, items, 3);
+    TEST_ASSERT_EQUAL_size_t(int_buf.capacity - 2, int_buf.start);
+    TEST_ASSERT_EQUAL_INT(1, ((int *)int_buf.data)[int_buf.capacity - 2]);
+    TEST_ASSERT_EQUAL_INT(2, ((int *)int_buf.data)[int_buf.capacity - 1]);
+    TEST_ASSERT_EQUAL_INT(3, ((int *)int_buf.data)[0]);
+}
+void check_ring_buffer_push_front_n_without_wrap_data(void) {
+    int items[3] = { 1, 2, 3 };
+    int_buf.start = 5;
+    ring_buffer_api_push_front_n(&int_buf, items, 3);
+    TEST_ASSERT_EQUAL_size_t(2U, int_buf.start);
+    TEST_ASSERT_EQUAL_size_t(3U, int_buf.size);
+    TEST_ASSERT_EQUAL_INT_ARRAY(items, &((int *)int_buf.data)[2], 3);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_push_back_n Test ring buffer push back n function
+ * @{
+ */
+
+void check_ring_buffer_push_back_n_with_null_handler(void) {
+    int items[3] = { 1, 2, 3 };
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_push_back_n(NULL, items, 3));
+}
+void check_ring_buffer_push_back_n_with_null_items(void) {
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_push_back_n(&int_buf, NULL, 3));
+}
+void check_ring_buffer_push_back_n_when_full(void) {
+    int items[3] = { 1, 2, 3 };
+    int_buf.size = int_buf.capacity;
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_push_back_n(&int_buf, items, 3));
+}
+void check_ring_buffer_push_back_n_partial(void) {
+    int items[3] = { 1, 2, 3 };
+    int_buf.size = int_buf.capacity - 2;
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_api_push_back_n(&int_buf, items, 3));
+    TEST_ASSERT_EQUAL_size_t(int_buf.capacity, int_buf.size);
+}
+void check_ring_buffer_push_back_n_with_wrap_data(void) {
+    int items[3] = { 1, 2, 3 };
+    int_buf.start = int_buf.capacity - 2;
+    ring_buffer_api_push_back_n(&int_buf, items, 3);
+    TEST_ASSERT_EQUAL_size_t(3U, int_buf.size);
+    TEST_ASSERT_EQUAL_INT(1, ((int *)int_buf.data)[int_buf.capacity - 2]);
+    TEST_ASSERT_EQUAL_INT(2, ((int *)int_buf.data)[int_buf.capacity - 1]);
+    TEST_ASSERT_EQUAL_INT(3, ((int *)int_buf.data)[0]);
+}
+void check_ring_buffer_push_back_n_without_wrap_data(void) {
+    int items[3] = { 1, 2, 3 };
+    int_buf.start = 2;
+    ring_buffer_api_push_back_n(&int_buf, items, 3);
+    TEST_ASSERT_EQUAL_size_t(2U, int_buf.start);
+    TEST_ASSERT_EQUAL_size_t(3U, int_buf.size);
+    TEST_ASSERT_EQUAL_INT_ARRAY(items, &((int *)int_buf.data)[2], 3);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_pop_front_n Test ring buffer pop front n function
+ * @{
+ */
+
+void check_ring_buffer_pop_front_n_with_null_handler(void) {
+    int out[3] = { 0 };
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_pop_front_n(NULL, out, 3));
+}
+void check_ring_buffer_pop_front_n_with_null_out(void) {
+    int_buf.size = 4;
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_pop_front_n(&int_buf, NULL, 3));
+    TEST_ASSERT_EQUAL_size_t(1U, int_buf.size);
+}
+void check_ring_buffer_pop_front_n_when_empty(void) {
+    int out[3] = { 0 };
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_pop_front_n(&int_buf, out, 3));
+}
+void check_ring_buffer_pop_front_n_partial(void) {
+    int out[3] = { 0 };
+    int_buf.size = 2;
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_api_pop_front_n(&int_buf, out, 3));
+    TEST_ASSERT_EQUAL_size_t(0U, int_buf.size);
+}
+void check_ring_buffer_pop_front_n_with_wrap_data(void) {
+    int expected[3] = { 1, 2, 3 };
+    int out[3] = { 0 };
+    int_buf.start = int_buf.capacity - 1;
+    int_buf.size = 3;
+    ((int *)int_buf.data)[int_buf.capacity - 1] = 1;
+    ((int *)int_buf.data)[0] = 2;
+    ((int *)int_buf.data)[1] = 3;
+
+    ring_buffer_api_pop_front_n(&int_buf, out, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, out, 3);
+    TEST_ASSERT_EQUAL_size_t(2U, int_buf.start);
+}
+void check_ring_buffer_pop_front_n_without_wrap_data(void) {
+    int expected[3] = { 1, 2, 3 };
+    int out[3] = { 0 };
+    int_buf.start = 4;
+    int_buf.size = 3;
+    memcpy(&((int *)int_buf.data)[4], expected, sizeof(expected));
+
+    ring_buffer_api_pop_front_n(&int_buf, out, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, out, 3);
+    TEST_ASSERT_EQUAL_size_t(7U, int_buf.start);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_pop_back_n Test ring buffer pop back n function
+ * @{
+ */
+
+void check_ring_buffer_pop_back_n_with_null_handler(void) {
+    int out[3] = { 0 };
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_pop_back_n(NULL, out, 3));
+}
+void check_ring_buffer_pop_back_n_with_null_out(void) {
+    int_buf.size = 4;
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_pop_back_n(&int_buf, NULL, 3));
+    TEST_ASSERT_EQUAL_size_t(1U, int_buf.size);
+}
+void check_ring_buffer_pop_back_n_when_empty(void) {
+    int out[3] = { 0 };
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_pop_back_n(&int_buf, out, 3));
+}
+void check_ring_buffer_pop_back_n_with_wrap_data(void) {
+    int expected[3] = { 1, 2, 3 };
+    int out[3] = { 0 };
+    int_buf.start = int_buf.capacity - 2;
+    int_buf.size = 4;
+    ((int *)int_buf.data)[int_buf.capacity - 1] = 1;
+    ((int *)int_buf.data)[0] = 2;
+    ((int *)int_buf.data)[1] = 3;
+
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_pop_back_n(&int_buf, out, 3));
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, out, 3);
+    TEST_ASSERT_EQUAL_size_t(1U, int_buf.size);
+}
+void check_ring_buffer_pop_back_n_without_wrap_data(void) {
+    int expected[3] = { 1, 2, 3 };
+    int out[3] = { 0 };
+    int_buf.start = 2;
+    int_buf.size = 5;
+    memcpy(&((int *)int_buf.data)[4], expected, sizeof(expected));
+
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_pop_back_n(&int_buf, out, 3));
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, out, 3);
+    TEST_ASSERT_EQUAL_size_t(2U, int_buf.size);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_reserve_back Test ring buffer reserve back function
+ * @{
+ */
+
+void check_ring_buffer_reserve_back_with_null_handler(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_reserve_back(NULL, 3, &seg1, &len1, &seg2, &len2));
+}
+void check_ring_buffer_reserve_back_with_null_segment(void) {
+    size_t len1, len2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_reserve_back(&int_buf, 3, NULL, &len1, NULL, &len2));
+}
+void check_ring_buffer_reserve_back_when_full(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    int_buf.size = int_buf.capacity;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_api_reserve_back(&int_buf, 3, &seg1, &len1, &seg2, &len2));
+}
+void check_ring_buffer_reserve_back_without_wrap(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    int_buf.start = 2;
+    int_buf.size = 1;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_reserve_back(&int_buf, 3, &seg1, &len1, &seg2, &len2));
+    TEST_ASSERT_EQUAL_PTR(&((int *)int_buf.data)[3], seg1);
+    TEST_ASSERT_EQUAL_size_t(3U, len1);
+    TEST_ASSERT_NULL(seg2);
+    TEST_ASSERT_EQUAL_size_t(0U, len2);
+}
+void check_ring_buffer_reserve_back_with_wrap(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    int_buf.start = int_buf.capacity - 3;
+    int_buf.size = 1;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_reserve_back(&int_buf, 4, &seg1, &len1, &seg2, &len2));
+    TEST_ASSERT_EQUAL_PTR(&((int *)int_buf.data)[int_buf.capacity - 2], seg1);
+    TEST_ASSERT_EQUAL_size_t(2U, len1);
+    TEST_ASSERT_EQUAL_PTR(int_buf.data, seg2);
+    TEST_ASSERT_EQUAL_size_t(2U, len2);
+}
+void check_ring_buffer_reserve_back_partial(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    int_buf.size = int_buf.capacity - 2;
+    ring_buffer_api_reserve_back(&int_buf, 5, &seg1, &len1, &seg2, &len2);
+    TEST_ASSERT_EQUAL_size_t(2U, len1 + len2);
+}
+void check_ring_buffer_reserve_back_size(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    ring_buffer_api_reserve_back(&int_buf, 3, &seg1, &len1, &seg2, &len2);
+    TEST_ASSERT_EQUAL_size_t(0U, int_buf.size);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_commit_back Test ring buffer commit back function
+ * @{
+ */
+
+void check_ring_buffer_commit_back_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_commit_back(NULL, 1));
+}
+void check_ring_buffer_commit_back_when_too_many(void) {
+    int_buf.size = int_buf.capacity - 1;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_api_commit_back(&int_buf, 2));
+    TEST_ASSERT_EQUAL_size_t(int_buf.capacity - 1, int_buf.size);
+}
+void check_ring_buffer_commit_back_size(void) {
+    int_buf.size = 1;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_commit_back(&int_buf, 2));
+    TEST_ASSERT_EQUAL_size_t(3U, int_buf.size);
+}
+void check_ring_buffer_commit_back_data(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    int_buf.start = int_buf.capacity - 1;
+    ring_buffer_api_reserve_back(&int_buf, 2, &seg1, &len1, &seg2, &len2);
+    ((int *)seg1)[0] = 1;
+    ((int *)seg2)[0] = 2;
+    ring_buffer_api_commit_back(&int_buf, 2);
+
+    int val = 0;
+    ring_buffer_api_front(&int_buf, &val);
+    TEST_ASSERT_EQUAL_INT(1, val);
+    ring_buffer_api_back(&int_buf, &val);
+    TEST_ASSERT_EQUAL_INT(2, val);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_acquire_front Test ring buffer acquire front function
+ * @{
+ */
+
+void check_ring_buffer_acquire_front_with_null_handler(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_acquire_front(NULL, 3, &seg1, &len1, &seg2, &len2));
+}
+void check_ring_buffer_acquire_front_with_null_segment(void) {
+    size_t len1, len2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_acquire_front(&int_buf, 3, NULL, &len1, NULL, &len2));
+}
+void check_ring_buffer_acquire_front_when_empty(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_acquire_front(&int_buf, 3, &seg1, &len1, &seg2, &len2));
+}
+void check_ring_buffer_acquire_front_without_wrap(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    int_buf.start = 2;
+    int_buf.size = 5;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_acquire_front(&int_buf, 3, &seg1, &len1, &seg2, &len2));
+    TEST_ASSERT_EQUAL_PTR(&((int *)int_buf.data)[2], seg1);
+    TEST_ASSERT_EQUAL_size_t(3U, len1);
+    TEST_ASSERT_NULL(seg2);
+    TEST_ASSERT_EQUAL_size_t(0U, len2);
+}
+void check_ring_buffer_acquire_front_with_wrap(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    int_buf.start = int_buf.capacity - 1;
+    int_buf.size = 3;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_acquire_front(&int_buf, 5, &seg1, &len1, &seg2, &len2));
+    TEST_ASSERT_EQUAL_PTR(&((int *)int_buf.data)[int_buf.capacity - 1], seg1);
+    TEST_ASSERT_EQUAL_size_t(1U, len1);
+    TEST_ASSERT_EQUAL_PTR(int_buf.data, seg2);
+    TEST_ASSERT_EQUAL_size_t(2U, len2);
+}
+void check_ring_buffer_acquire_front_size(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    int_buf.size = 3;
+    ring_buffer_api_acquire_front(&int_buf, 3, &seg1, &len1, &seg2, &len2);
+    TEST_ASSERT_EQUAL_size_t(3U, int_buf.size);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_release_front Test ring buffer release front function
+ * @{
+ */
+
+void check_ring_buffer_release_front_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_release_front(NULL, 1));
+}
+void check_ring_buffer_release_front_when_too_many(void) {
+    int_buf.size = 1;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_release_front(&int_buf, 2));
+    TEST_ASSERT_EQUAL_size_t(1U, int_buf.size);
+}
+void check_ring_buffer_release_front_with_wrap_index(void) {
+    int_buf.start = int_buf.capacity - 1;
+    int_buf.size = 3;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_release_front(&int_buf, 2));
+    TEST_ASSERT_EQUAL_size_t(1U, int_buf.start);
+    TEST_ASSERT_EQUAL_size_t(1U, int_buf.size);
+}
+void check_ring_buffer_release_front_without_wrap_index(void) {
+    int_buf.start = 2;
+    int_buf.size = 3;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_release_front(&int_buf, 2));
+    TEST_ASSERT_EQUAL_size_t(4U, int_buf.start);
+    TEST_ASSERT_EQUAL_size_t(1U, int_buf.size);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_push_back_overwrite Test ring buffer push back overwrite function
+ * @{
+ */
+
+void check_ring_buffer_push_back_overwrite_with_null_handler(void) {
+    int val = 1;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_push_back_overwrite(NULL, &val, NULL));
+}
+void check_ring_buffer_push_back_overwrite_with_null_item(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_push_back_overwrite(&int_buf, NULL, NULL));
+}
+void check_ring_buffer_push_back_overwrite_when_not_full(void) {
+    int val = 42;
+    int_buf.start = 3;
+    int_buf.size = 2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_push_back_overwrite(&int_buf, &val, NULL));
+    TEST_ASSERT_EQUAL_size_t(3U, int_buf.size);
+    TEST_ASSERT_EQUAL_INT(42, ((int *)int_buf.data)[5]);
+}
+void check_ring_buffer_push_back_overwrite_when_full_return_value(void) {
+    int val = 42;
+    int_buf.size = int_buf.capacity;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OVERWRITTEN, ring_buffer_api_push_back_overwrite(&int_buf, &val, NULL));
+    TEST_ASSERT_EQUAL_size_t(int_buf.capacity, int_buf.size);
+}
+void check_ring_buffer_push_back_overwrite_when_full_data(void) {
+    int val = 42;
+    int evicted = 0;
+    int_buf.start = 3;
+    int_buf.size = int_buf.capacity;
+    ((int *)int_buf.data)[3] = 7;
+    ((int *)int_buf.data)[4] = 8;
+    ring_buffer_api_push_back_overwrite(&int_buf, &val, &evicted);
+    TEST_ASSERT_EQUAL_INT(7, evicted);
+    TEST_ASSERT_EQUAL_size_t(4U, int_buf.start);
+
+    int front = 0, back = 0;
+    ring_buffer_api_front(&int_buf, &front);
+    ring_buffer_api_back(&int_buf, &back);
+    TEST_ASSERT_EQUAL_INT(8, front);
+    TEST_ASSERT_EQUAL_INT(42, back);
+}
+void check_ring_buffer_push_back_overwrite_when_full_with_wrap(void) {
+    int val = 42;
+    int_buf.start = int_buf.capacity - 1;
+    int_buf.size = int_buf.capacity;
+    ring_buffer_api_push_back_overwrite(&int_buf, &val, NULL);
+    TEST_ASSERT_EQUAL_size_t(0U, int_buf.start);
+    TEST_ASSERT_EQUAL_INT(42, ((int *)int_buf.data)[int_buf.capacity - 1]);
+}
+void check_ring_buffer_push_back_overwrite_with_zero_capacity(void) {
+    int val = 42, evicted = 0, storage[1];
+    RingBufferHandler_t buf;
+    ring_buffer_api_init_static(&buf, sizeof(int), 0, NULL, NULL, storage);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_api_push_back_overwrite(&buf, &val, &evicted));
+    TEST_ASSERT_EQUAL_size_t(0U, buf.size);
+    TEST_ASSERT_EQUAL_size_t(0U, buf.start);
+    TEST_ASSERT_EQUAL_INT(0, evicted);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_stream Test ring buffer byte-stream write and read functions
+ * @{
+ */
+
+void check_ring_buffer_write_with_null(void) {
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_write(NULL, "abc", 3));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_write(&byte_buf, NULL, 3));
+}
+void check_ring_buffer_write_with_wrong_data_size(void) {
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_write(&int_buf, "abcd", 4));
+    TEST_ASSERT_EQUAL_size_t(0U, int_buf.size);
+}
+void check_ring_buffer_write_data(void) {
+    TEST_ASSERT_EQUAL_size_t(5U, ring_buffer_api_write(&byte_buf, "hello", 5));
+    TEST_ASSERT_EQUAL_size_t(5U, byte_buf.size);
+    TEST_ASSERT_EQUAL_MEMORY("hello", byte_buf.data, 5);
+}
+void check_ring_buffer_write_when_almost_full(void) {
+    uint8_t data[32] = { 0 };
+    byte_buf.size = byte_buf.capacity - 3;
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_write(&byte_buf, data, sizeof(data)));
+    TEST_ASSERT_TRUE(ring_buffer_api_is_full(&byte_buf));
+}
+void check_ring_buffer_read_with_null(void) {
+    uint8_t data[4];
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_read(NULL, data, 4));
+}
+void check_ring_buffer_read_with_wrong_data_size(void) {
+    int data[2];
+    int_buf.size = 2;
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_read(&int_buf, data, 2));
+    TEST_ASSERT_EQUAL_size_t(2U, int_buf.size);
+}
+void check_ring_buffer_read_with_wrap_index(void) {
+    char data[8] = { 0 };
+    byte_buf.start = byte_buf.capacity - 2;
+    ring_buffer_api_write(&byte_buf, "abcdef", 6);
+    TEST_ASSERT_EQUAL_size_t(6U, ring_buffer_api_read(&byte_buf, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_STRING("abcdef", data);
+    TEST_ASSERT_TRUE(ring_buffer_api_is_empty(&byte_buf));
+}
+void check_ring_buffer_read_discard(void) {
+    char data[4] = { 0 };
+    ring_buffer_api_write(&byte_buf, "abcdef", 6);
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_read(&byte_buf, NULL, 3));
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_read(&byte_buf, data, 3));
+    TEST_ASSERT_EQUAL_STRING("def", data);
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_delimiter Test ring buffer find and read until functions
+ * @{
+ */
+
+void check_ring_buffer_find_with_null(void) {
+    TEST_ASSERT_EQUAL_size_t(RING_BUFFER_NOT_FOUND, ring_buffer_api_find(NULL, '\n'));
+}
+void check_ring_buffer_find_with_wrong_data_size(void) {
+    int val = '\n';
+    ring_buffer_api_push_back(&int_buf, &val);
+    TEST_ASSERT_EQUAL_size_t(RING_BUFFER_NOT_FOUND, ring_buffer_api_find(&int_buf, '\n'));
+}
+void check_ring_buffer_find_not_found(void) {
+    ring_buffer_api_write(&byte_buf, "abc", 3);
+    TEST_ASSERT_EQUAL_size_t(RING_BUFFER_NOT_FOUND, ring_buffer_api_find(&byte_buf, '\n'));
+}
+void check_ring_buffer_find_ignores_free_slots(void) {
+    memset(byte_buf.data, '\n', byte_buf.capacity);
+    byte_buf.start = 2;
+    byte_buf.size = 0;
+    ring_buffer_api_write(&byte_buf, "abc", 3);
+    TEST_ASSERT_EQUAL_size_t(RING_BUFFER_NOT_FOUND, ring_buffer_api_find(&byte_buf, '\n'));
+}
+void check_ring_buffer_find_with_wrap_index(void) {
+    byte_buf.start = byte_buf.capacity - 2;
+    ring_buffer_api_write(&byte_buf, "ab~cd~", 6);
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_api_find(&byte_buf, '~'));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_find(&byte_buf, 'a'));
+    TEST_ASSERT_EQUAL_size_t(4U, ring_buffer_api_find(&byte_buf, 'd'));
+}
+void check_ring_buffer_read_until_with_null(void) {
+    char data[4];
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_read_until(NULL, '\n', data, sizeof(data)));
+}
+void check_ring_buffer_read_until_data(void) {
+    char data[8] = { 0 };
+    byte_buf.start = byte_buf.capacity - 2;
+    ring_buffer_api_write(&byte_buf, "ab\ncd\ne", 8);
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_read_until(&byte_buf, '\n', data, sizeof(data)));
+    TEST_ASSERT_EQUAL_MEMORY("ab\n", data, 3);
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_read_until(&byte_buf, '\n', data, sizeof(data)));
+    TEST_ASSERT_EQUAL_MEMORY("cd\n", data, 3);
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_read_until(&byte_buf, '\n', data, sizeof(data)));
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_api_size(&byte_buf));
+}
+void check_ring_buffer_read_until_frame_too_long(void) {
+    char data[3];
+    ring_buffer_api_write(&byte_buf, "abc\n", 4);
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_read_until(&byte_buf, '\n', data, sizeof(data)));
+    TEST_ASSERT_EQUAL_size_t(4U, ring_buffer_api_size(&byte_buf));
+    TEST_ASSERT_EQUAL_size_t(4U, ring_buffer_api_read_until(&byte_buf, '\n', NULL, 4));
+    TEST_ASSERT_TRUE(ring_buffer_api_is_empty(&byte_buf));
+}
+void check_ring_buffer_acquire_until_with_null(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_acquire_until(NULL, '~', &seg1, &len1, &seg2, &len2));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_acquire_until(&byte_buf, '~', NULL, &len1, &seg2, &len2));
+}
+void check_ring_buffer_acquire_until_not_found(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    ring_buffer_api_write(&byte_buf, "abc", 3);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_acquire_until(&byte_buf, '~', &seg1, &len1, &seg2, &len2));
+}
+void check_ring_buffer_acquire_until_with_wrap_index(void) {
+    void *seg1, *seg2;
+    size_t len1, len2;
+    byte_buf.start = byte_buf.capacity - 2;
+    ring_buffer_api_write(&byte_buf, "abc~d", 5);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_acquire_until(&byte_buf, '~', &seg1, &len1, &seg2, &len2));
+    TEST_ASSERT_EQUAL_size_t(2U, len1);
+    TEST_ASSERT_EQUAL_size_t(2U, len2);
+    TEST_ASSERT_EQUAL_MEMORY("ab", seg1, 2);
+    TEST_ASSERT_EQUAL_MEMORY("c~", seg2, 2);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_release_front(&byte_buf, len1 + len2));
+    TEST_ASSERT_EQUAL_size_t(1U, ring_buffer_api_size(&byte_buf));
+}
+
+/*! @} */
+
+/*! 
+ * \defgroup ring_buffer_span Test ring buffer front and back span functions
+ * @{
+ */
+
+void check_ring_buffer_front_span_with_null(void) {
+    size_t count;
+    TEST_ASSERT_NULL(ring_buffer_api_front_span(NULL, &count));
+    TEST_ASSERT_NULL(ring_buffer_api_front_span(&int_buf, NULL));
+}
+void check_ring_buffer_front_span_when_empty(void) {
+    size_t count = 1U;
+    TEST_ASSERT_NULL(ring_buffer_api_front_span(&int_buf, &count));
+    TEST_ASSERT_EQUAL_size_t(0U, count);
+}
+void check_ring_buffer_front_span_data(void) {
+    size_t count;
+    int_buf.start = 2;
+    int_buf.size = 3;
+    TEST_ASSERT_EQUAL_PTR(&((int *)int_buf.data)[2], ring_buffer_api_front_span(&int_buf, &count));
+    TEST_ASSERT_EQUAL_size_t(3U, count);
+}
+void check_ring_buffer_front_span_with_wrap_index(void) {
+    size_t count;
+    int_buf.start = int_buf.capacity - 2;
+    int_buf.size = 5;
+    TEST_ASSERT_EQUAL_PTR(&((int *)int_buf.data)[int_buf.capacity - 2], ring_buffer_api_front_span(&int_buf, &count));
+    TEST_ASSERT_EQUAL_size_t(2U, count);
+}
+void check_ring_buffer_back_span_with_null(void) {
+    size_t count;
+    TEST_ASSERT_NULL(ring_buffer_api_back_span(NULL, &count));
+    TEST_ASSERT_NULL(ring_buffer_api_back_span(&int_buf, NULL));
+}
+void check_ring_buffer_back_span_when_full(void) {
+    size_t count = 1U;
+    int_buf.size = int_buf.capacity;
+    TEST_ASSERT_NULL(ring_buffer_api_back_span(&int_buf, &count));
+    TEST_ASSERT_EQUAL_size_t(0U, count);
+}
+void check_ring_buffer_back_span_data(void) {
+    size_t count;
+    int_buf.start = 2;
+    int_buf.size = 3;
+    TEST_ASSERT_EQUAL_PTR(&((int *)int_buf.data)[5], ring_buffer_api_back_span(&int_buf, &count));
+    TEST_ASSERT_EQUAL_size_t(int_buf.capacity - 5, count);
+}
+void check_ring_buffer_back_span_with_wrap_index(void) {
+    size_t count;
+    int_buf.start = int_buf.capacity - 2;
+    int_buf.size = 5;
+    TEST_ASSERT_EQUAL_PTR(&((int *)int_buf.data)[3], ring_buffer_api_back_span(&int_buf, &count));
+    TEST_ASSERT_EQUAL_size_t(int_buf.capacity - 5, count);
+}
+void check_ring_buffer_back_span_commit(void) {
+    size_t count;
+    int *slots = ring_buffer_api_back_span(&int_buf, &count);
+    slots[0] = 4;
+    slots[1] = 2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_commit_back(&int_buf, 2));
+
+    int *items = ring_buffer_api_front_span(&int_buf, &count);
+    TEST_ASSERT_EQUAL_size_t(2U, count);
+    TEST_ASSERT_EQUAL_INT(4, items[0]);
+    TEST_ASSERT_EQUAL_INT(2, items[1]);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_release_front(&int_buf, count));
+    TEST_ASSERT_TRUE(ring_buffer_api_is_empty(&int_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_for_each Test ring buffer for each and iterator functions
+ * @{
+ */
+
+typedef struct {
+    int items[10];
+    size_t indices[10];
+    size_t count;
+    size_t stop_after;
+} Visit;
+
+static bool record_visit(void *item, size_t index, void *ctx) {
+    Visit *visit = (Visit *)ctx;
+    visit->items[visit->count] = *(int *)item;
+    visit->indices[visit->count] = index;
+    ++visit->count;
+    return visit->count < visit->stop_after;
+}
+
+static bool double_item(void *item, size_t index, void *ctx) {
+    (void)index;
+    (void)ctx;
+    *(int *)item *= 2;
+    return true;
+}
+
+static void fill_with_wrap(void) {
+    int_buf.start = int_buf.capacity - 2;
+    for (int i = 0; i < 5; ++i)
+        ring_buffer_api_push_back(&int_buf, &i);
+}
+
+void check_ring_buffer_for_each_with_null(void) {
+    Visit visit = { .stop_after = 10 };
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_for_each(NULL, record_visit, &visit));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_for_each(&int_buf, NULL, &visit));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_for_each_reverse(NULL, record_visit, &visit));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_for_each_reverse(&int_buf, NULL, &visit));
+}
+void check_ring_buffer_for_each_when_empty(void) {
+    Visit visit = { .stop_after = 10 };
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_for_each(&int_buf, record_visit, &visit));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_for_each_reverse(&int_buf, record_visit, &visit));
+    TEST_ASSERT_EQUAL_size_t(0U, visit.count);
+}
+void check_ring_buffer_for_each_with_wrap_index(void) {
+    Visit visit = { .stop_after = 10 };
+    const int expected[] = { 0, 1, 2, 3, 4 };
+    const size_t indices[] = { 0, 1, 2, 3, 4 };
+    fill_with_wrap();
+    TEST_ASSERT_EQUAL_size_t(5U, ring_buffer_api_for_each(&int_buf, record_visit, &visit));
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, visit.items, 5);
+    TEST_ASSERT_EQUAL_size_t_ARRAY(indices, visit.indices, 5);
+    TEST_ASSERT_EQUAL_size_t(5U, ring_buffer_api_size(&int_buf));
+}
+void check_ring_buffer_for_each_stop(void) {
+    Visit visit = { .stop_after = 3 };
+    fill_with_wrap();
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_api_for_each(&int_buf, record_visit, &visit));
+    TEST_ASSERT_EQUAL_INT(2, visit.items[2]);
+}
+void check_ring_buffer_for_each_modify(void) {
+    int out;
+    fill_with_wrap();
+    ring_buffer_api_for_each(&int_buf, double_item, NULL);
+    ring_buffer_api_back(&int_buf, &out);
+    TEST_ASSERT_EQUAL_INT(8, out);
+}
+void check_ring_buffer_for_each_reverse_with_wrap_index(void) {
+    Visit visit = { .stop_after = 10 };
+    const int expected[] = { 4, 3, 2, 1, 0 };
+    const size_t indices[] = { 4, 3, 2, 1, 0 };
+    fill_with_wrap();
+    TEST_ASSERT_EQUAL_size_t(5U, ring_buffer_api_for_each_reverse(&int_buf, record_visit, &visit));
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, visit.items, 5);
+    TEST_ASSERT_EQUAL_size_t_ARRAY(indices, visit.indices, 5);
+}
+void check_ring_buffer_for_each_reverse_stop(void) {
+    Visit visit = { .stop_after = 1 };
+    fill_with_wrap();
+    TEST_ASSERT_EQUAL_size_t(1U, ring_buffer_api_for_each_reverse(&int_buf, record_visit, &visit));
+    TEST_ASSERT_EQUAL_INT(4, visit.items[0]);
+    TEST_ASSERT_EQUAL_size_t(4U, visit.indices[0]);
+}
+void check_ring_buffer_iter_with_null(void) {
+    RingBufferIterator_t it;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_iter_begin(NULL, &it, false));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_iter_begin(&int_buf, NULL, false));
+    TEST_ASSERT_NULL(ring_buffer_api_iter_next(NULL));
+}
+void check_ring_buffer_iter_when_empty(void) {
+    RingBufferIterator_t it;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_iter_begin(&int_buf, &it, true));
+    TEST_ASSERT_NULL(ring_buffer_api_iter_next(&it));
+    ring_buffer_api_iter_end(&it);
+}
+void check_ring_buffer_iter_with_wrap_index(void) {
+    RingBufferIterator_t it;
+    int *item;
+    int expected = 0;
+    fill_with_wrap();
+    ring_buffer_api_iter_begin(&int_buf, &it, false);
+    while ((item = ring_buffer_api_iter_next(&it)) != NULL)
+        TEST_ASSERT_EQUAL_INT(expected++, *item);
+    ring_buffer_api_iter_end(&it);
+    TEST_ASSERT_EQUAL_INT(5, expected);
+}
+void check_ring_buffer_iter_reverse_with_wrap_index(void) {
+    RingBufferIterator_t it;
+    int *item;
+    int expected = 4;
+    fill_with_wrap();
+    ring_buffer_api_iter_begin(&int_buf, &it, true);
+    while ((item = ring_buffer_api_iter_next(&it)) != NULL)
+        TEST_ASSERT_EQUAL_INT(expected--, *item);
+    ring_buffer_api_iter_end(&it);
+    TEST_ASSERT_EQUAL_INT(-1, expected);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_at Test ring buffer random access functions
+ * @{
+ */
+
+void check_ring_buffer_at_with_null(void) {
+    int val = 42;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_at(NULL, 0, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_at(&int_buf, 0, NULL));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_at_back(NULL, 0, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_at_back(&int_buf, 0, NULL));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_set(NULL, 0, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_set(&int_buf, 0, NULL));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_set_back(NULL, 0, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_set_back(&int_buf, 0, NULL));
+}
+void check_ring_buffer_at_out_of_range(void) {
+    int val = 42;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_at(&int_buf, 0, &val));
+    ring_buffer_api_push_back(&int_buf, &val);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_at(&int_buf, 1, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_at_back(&int_buf, 1, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_set(&int_buf, 1, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_set_back(&int_buf, 1, &val));
+}
+void check_ring_buffer_at_with_wrap_index(void) {
+    int out;
+    int_buf.start = int_buf.capacity - 2;
+    for (int i = 0; i < 5; ++i)
+        ring_buffer_api_push_back(&int_buf, &i);
+    for (int i = 0; i < 5; ++i) {
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_at(&int_buf, i, &out));
+        TEST_ASSERT_EQUAL_INT(i, out);
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_at_back(&int_buf, i, &out));
+        TEST_ASSERT_EQUAL_INT(4 - i, out);
+    }
+}
+void check_ring_buffer_set_with_wrap_index(void) {
+    int val = 7, out;
+    int_buf.start = int_buf.capacity - 2;
+    for (int i = 0; i < 5; ++i)
+        ring_buffer_api_push_back(&int_buf, &i);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_set(&int_buf, 3, &val));
+    val = 9;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_set_back(&int_buf, 4, &val));
+    ring_buffer_api_front(&int_buf, &out);
+    TEST_ASSERT_EQUAL_INT(9, out);
+    ring_buffer_api_at_back(&int_buf, 1, &out);
+    TEST_ASSERT_EQUAL_INT(7, out);
+    TEST_ASSERT_EQUAL_size_t(5U, ring_buffer_api_size(&int_buf));
+}
+void check_ring_buffer_at_unchecked(void) {
+    Point p = { .x = 1.0f, .y = 2.0f };
+    point_buf.start = point_buf.capacity - 1;
+    ring_buffer_api_push_back(&point_buf, &p);
+    p.x = 3.0f;
+    ring_buffer_api_push_back(&point_buf, &p);
+    TEST_ASSERT_EQUAL_PTR(&((Point *)point_buf.data)[point_buf.capacity - 1], ring_buffer_api_at_unchecked(&point_buf, 0));
+    TEST_ASSERT_EQUAL_PTR(&((Point *)point_buf.data)[0], ring_buffer_api_at_unchecked(&point_buf, 1));
+    TEST_ASSERT_EQUAL_PTR(&((Point *)point_buf.data)[0], ring_buffer_api_at_back_unchecked(&point_buf, 0));
+    ((Point *)ring_buffer_api_at_back_unchecked(&point_buf, 1))->y = 5.0f;
+    ring_buffer_api_front(&point_buf, &p);
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, p.y);
+}
+
+/*! @} */
+
+#ifdef RING_BUFFER_STATS
+
+/*!
+ * \defgroup ring_buffer_stats Test ring buffer statistics functions
+ * @{
+ */
+
+void check_ring_buffer_stats_with_null(void) {
+    RingBufferStats_t stats;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_stats(NULL, &stats));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_stats(&int_buf, NULL));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_stats_reset(NULL));
+}
+void check_ring_buffer_stats_after_init(void) {
+    RingBufferStats_t stats;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_stats(&int_buf, &stats));
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.pops);
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.full);
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.empty);
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.overwrites);
+    TEST_ASSERT_EQUAL_size_t(0U, stats.high_watermark);
+}
+void check_ring_buffer_stats_push_and_pop(void) {
+    RingBufferStats_t stats;
+    int val[4] = { 1, 2, 3, 4 };
+    ring_buffer_api_push_back(&int_buf, &val[0]);
+    ring_buffer_api_push_front(&int_buf, &val[1]);
+    ring_buffer_api_push_back_n(&int_buf, val, 4);
+    ring_buffer_api_pop_front(&int_buf, NULL);
+    ring_buffer_api_pop_back_n(&int_buf, NULL, 2);
+    ring_buffer_api_stats(&int_buf, &stats);
+    TEST_ASSERT_EQUAL_UINT64(6U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT64(3U, stats.pops);
+    TEST_ASSERT_EQUAL_size_t(6U, stats.high_watermark);
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.full);
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.empty);
+}
+void check_ring_buffer_stats_rejections(void) {
+    RingBufferStats_t stats;
+    int val = 42;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_pop_front(&int_buf, NULL));
+    int_buf.size = int_buf.capacity;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_api_push_back(&int_buf, &val));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_push_back_n(&int_buf, &val, 1));
+    ring_buffer_api_stats(&int_buf, &stats);
+    TEST_ASSERT_EQUAL_UINT64(2U, stats.full);
+    TEST_ASSERT_EQUAL_UINT64(1U, stats.empty);
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.pushes);
+}
+void check_ring_buffer_stats_overwrites(void) {
+    RingBufferStats_t stats;
+    for (int i = 0; i < (int)int_buf.capacity + 3; ++i)
+        ring_buffer_api_push_back_overwrite(&int_buf, &i, NULL);
+    ring_buffer_api_stats(&int_buf, &stats);
+    TEST_ASSERT_EQUAL_UINT64(int_buf.capacity + 3U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT64(3U, stats.overwrites);
+    TEST_ASSERT_EQUAL_size_t(int_buf.capacity, stats.high_watermark);
+}
+void check_ring_buffer_stats_reset(void) {
+    RingBufferStats_t stats;
+    int val[3] = { 1, 2, 3 };
+    ring_buffer_api_push_back_n(&int_buf, val, 3);
+    ring_buffer_api_pop_front(&int_buf, NULL);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_stats_reset(&int_buf));
+    ring_buffer_api_stats(&int_buf, &stats);
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.pushes);
+    TEST_ASSERT_EQUAL_UINT64(0U, stats.pops);
+    TEST_ASSERT_EQUAL_size_t(2U, stats.high_watermark);
+}
+
+/*! @} */
+
+#endif // RING_BUFFER_STATS
+
+/*!
+ * \defgroup ring_buffer_init_static Test ring buffer static storage init
+ * @{
+ */
+
+static int static_storage[8];
+static RingBufferHandler_t static_buf = RING_BUFFER_INITIALIZER(static_storage, sizeof(int), 8, ring_buffer_cs_dummy, ring_buffer_cs_dummy);
+
+void check_ring_buffer_init_static_with_null(void) {
+    RingBufferHandler_t buf;
+    int storage[4];
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_init_static(NULL, sizeof(int), 4, NULL, NULL, storage));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_init_static(&buf, sizeof(int), 4, NULL, NULL, NULL));
+}
+void check_ring_buffer_init_static_storage_untouched(void) {
+    RingBufferHandler_t buf;
+    uint8_t storage[16];
+    memset(storage, 0xAA, sizeof(storage));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_init_static(&buf, sizeof(uint8_t), sizeof(storage), NULL, NULL, storage));
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xAA, storage, sizeof(storage));
+    TEST_ASSERT_EQUAL_PTR(storage, buf.data);
+    TEST_ASSERT_EQUAL_size_t(16U, buf.capacity);
+    TEST_ASSERT_TRUE(ring_buffer_api_is_empty(&buf));
+}
+void check_ring_buffer_init_static_push_and_pop(void) {
+    RingBufferHandler_t buf;
+    int storage[4], val = 42, out = 0;
+    ring_buffer_api_init_static(&buf, sizeof(int), 4, NULL, NULL, storage);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_push_back(&buf, &val));
+    TEST_ASSERT_EQUAL_INT(42, storage[0]);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_pop_front(&buf, &out));
+    TEST_ASSERT_EQUAL_INT(42, out);
+}
+void check_ring_buffer_init_static_capacity(void) {
+    RingBufferHandler_t buf;
+    int storage[10];
+    ring_buffer_api_init_static(&buf, sizeof(int), 10, NULL, NULL, storage);
+#ifdef RING_BUFFER_POWER_OF_TWO_CAPACITY
+    TEST_ASSERT_EQUAL_size_t(8U, buf.capacity);
+#else
+    TEST_ASSERT_EQUAL_size_t(10U, buf.capacity);
+#endif // RING_BUFFER_POWER_OF_TWO_CAPACITY
+}
+void check_ring_buffer_init_static_capacity_too_large(void) {
+    RingBufferHandler_t buf;
+    int storage[10];
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_api_init_static(&buf, sizeof(int), SIZE_MAX, NULL, NULL, storage));
+}
+void check_ring_buffer_init_static_invalid_data_size(void) {
+    RingBufferHandler_t buf;
+    int storage[10];
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_api_init_static(&buf, 0U, 10, NULL, NULL, storage));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_api_init_static(&buf, RING_BUFFER_MAX_DATA_SIZE + 1U, 1, NULL, NULL, storage));
+}
+void check_ring_buffer_initializer(void) {
+    int out;
+    TEST_ASSERT_TRUE(ring_buffer_api_is_empty(&static_buf));
+    TEST_ASSERT_EQUAL_size_t(8U, static_buf.capacity);
+    for (int i = 0; i < 10; ++i)
+        ring_buffer_api_push_back_overwrite(&static_buf, &i, NULL);
+    TEST_ASSERT_TRUE(ring_buffer_api_is_full(&static_buf));
+    ring_buffer_api_front(&static_buf, &out);
+    TEST_ASSERT_EQUAL_INT(2, out);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_clear(&static_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_copy_kernel Test ring buffer copy kernels
+ * @{
+ */
+
+void check_ring_buffer_copy_kernel_selection(void) {
+    const size_t sizes[] = { 1, 2, 4, 8, 16, 32, 64 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+        TEST_ASSERT_TRUE(ring_buffer_api_copy_kernel(sizes[i]) != ring_buffer_api_copy_generic);
+    TEST_ASSERT_TRUE(ring_buffer_api_copy_kernel(3) == ring_buffer_api_copy_generic);
+    TEST_ASSERT_TRUE(ring_buffer_api_copy_kernel(sizeof(Point) + 4) == ring_buffer_api_copy_generic);
+}
+void check_ring_buffer_copy_kernel_after_init(void) {
+    TEST_ASSERT_TRUE(int_buf.copy == ring_buffer_api_copy_kernel(sizeof(int)));
+    TEST_ASSERT_TRUE(byte_buf.copy == ring_buffer_api_copy_kernel(1));
+}
+void check_ring_buffer_copy_kernel_data(void) {
+    const size_t sizes[] = { 1, 2, 3, 4, 8, 12, 16, 32, 64 };
+    uint8_t item[64], out[64];
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        RingBufferHandler_t buf;
+        ring_buffer_api_init(&buf, sizes[i], 2, NULL, NULL, &arena);
+        for (size_t j = 0; j < sizes[i]; ++j)
+            item[j] = (uint8_t)(j * 7U + sizes[i]);
+        memset(out, 0, sizeof(out));
+        ring_buffer_api_push_back(&buf, item);
+        ring_buffer_api_push_front(&buf, item);
+        ring_buffer_api_pop_back(&buf, out);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(item, out, sizes[i]);
+        if (sizes[i] < sizeof(out))
+            TEST_ASSERT_EQUAL_UINT8(0, out[sizes[i]]);
+        memset(out, 0, sizeof(out));
+        ring_buffer_api_pop_front(&buf, out);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(item, out, sizes[i]);
+    }
+}
+
+/*! @} */
+
 int main() {
     UNITY_BEGIN();
 
@@ -628,6 +1650,9 @@ int main() {
     RUN_TEST(check_ring_buffer_init_with_null);
     RUN_TEST(check_ring_buffer_init_return_value);
     RUN_TEST(check_ring_buffer_init_defined_cs_function);
+    RUN_TEST(check_ring_buffer_init_capacity);
+    RUN_TEST(check_ring_buffer_init_capacity_too_large);
+    RUN_TEST(check_ring_buffer_init_invalid_data_size);
 
     /*! @} */
 
@@ -791,5 +1816,254 @@ int main() {
 
     /*! @} */
 
+    /*! 
+     * \addtogroup ring_buffer_push_front_n Run test for ring buffer push front n function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_push_front_n_with_null_handler);
+    RUN_TEST(check_ring_buffer_push_front_n_with_null_items);
+    RUN_TEST(check_ring_buffer_push_front_n_when_full);
+    RUN_TEST(check_ring_buffer_push_front_n_partial);
+    RUN_TEST(check_ring_buffer_push_front_n_with_wrap_data);
+    RUN_TEST(check_ring_buffer_push_front_n_without_wrap_data);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_push_back_n Run test for ring buffer push back n function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_push_back_n_with_null_handler);
+    RUN_TEST(check_ring_buffer_push_back_n_with_null_items);
+    RUN_TEST(check_ring_buffer_push_back_n_when_full);
+    RUN_TEST(check_ring_buffer_push_back_n_partial);
+    RUN_TEST(check_ring_buffer_push_back_n_with_wrap_data);
+    RUN_TEST(check_ring_buffer_push_back_n_without_wrap_data);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_pop_front_n Run test for ring buffer pop front n function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_pop_front_n_with_null_handler);
+    RUN_TEST(check_ring_buffer_pop_front_n_with_null_out);
+    RUN_TEST(check_ring_buffer_pop_front_n_when_empty);
+    RUN_TEST(check_ring_buffer_pop_front_n_partial);
+    RUN_TEST(check_ring_buffer_pop_front_n_with_wrap_data);
+    RUN_TEST(check_ring_buffer_pop_front_n_without_wrap_data);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_pop_back_n Run test for ring buffer pop back n function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_pop_back_n_with_null_handler);
+    RUN_TEST(check_ring_buffer_pop_back_n_with_null_out);
+    RUN_TEST(check_ring_buffer_pop_back_n_when_empty);
+    RUN_TEST(check_ring_buffer_pop_back_n_with_wrap_data);
+    RUN_TEST(check_ring_buffer_pop_back_n_without_wrap_data);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_reserve_back Run test for ring buffer reserve back function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_reserve_back_with_null_handler);
+    RUN_TEST(check_ring_buffer_reserve_back_with_null_segment);
+    RUN_TEST(check_ring_buffer_reserve_back_when_full);
+    RUN_TEST(check_ring_buffer_reserve_back_without_wrap);
+    RUN_TEST(check_ring_buffer_reserve_back_with_wrap);
+    RUN_TEST(check_ring_buffer_reserve_back_partial);
+    RUN_TEST(check_ring_buffer_reserve_back_size);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_commit_back Run test for ring buffer commit back function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_commit_back_with_null);
+    RUN_TEST(check_ring_buffer_commit_back_when_too_many);
+    RUN_TEST(check_ring_buffer_commit_back_size);
+    RUN_TEST(check_ring_buffer_commit_back_data);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_acquire_front Run test for ring buffer acquire front function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_acquire_front_with_null_handler);
+    RUN_TEST(check_ring_buffer_acquire_front_with_null_segment);
+    RUN_TEST(check_ring_buffer_acquire_front_when_empty);
+    RUN_TEST(check_ring_buffer_acquire_front_without_wrap);
+    RUN_TEST(check_ring_buffer_acquire_front_with_wrap);
+    RUN_TEST(check_ring_buffer_acquire_front_size);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_release_front Run test for ring buffer release front function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_release_front_with_null);
+    RUN_TEST(check_ring_buffer_release_front_when_too_many);
+    RUN_TEST(check_ring_buffer_release_front_with_wrap_index);
+    RUN_TEST(check_ring_buffer_release_front_without_wrap_index);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_push_back_overwrite Run test for ring buffer push back overwrite function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_push_back_overwrite_with_null_handler);
+    RUN_TEST(check_ring_buffer_push_back_overwrite_with_null_item);
+    RUN_TEST(check_ring_buffer_push_back_overwrite_when_not_full);
+    RUN_TEST(check_ring_buffer_push_back_overwrite_when_full_return_value);
+    RUN_TEST(check_ring_buffer_push_back_overwrite_when_full_data);
+    RUN_TEST(check_ring_buffer_push_back_overwrite_when_full_with_wrap);
+    RUN_TEST(check_ring_buffer_push_back_overwrite_with_zero_capacity);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_stream Run test for ring buffer byte-stream write and read functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_write_with_null);
+    RUN_TEST(check_ring_buffer_write_with_wrong_data_size);
+    RUN_TEST(check_ring_buffer_write_data);
+    RUN_TEST(check_ring_buffer_write_when_almost_full);
+    RUN_TEST(check_ring_buffer_read_with_null);
+    RUN_TEST(check_ring_buffer_read_with_wrong_data_size);
+    RUN_TEST(check_ring_buffer_read_with_wrap_index);
+    RUN_TEST(check_ring_buffer_read_discard);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_delimiter Run test for ring buffer find and read until functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_find_with_null);
+    RUN_TEST(check_ring_buffer_find_with_wrong_data_size);
+    RUN_TEST(check_ring_buffer_find_not_found);
+    RUN_TEST(check_ring_buffer_find_ignores_free_slots);
+    RUN_TEST(check_ring_buffer_find_with_wrap_index);
+    RUN_TEST(check_ring_buffer_read_until_with_null);
+    RUN_TEST(check_ring_buffer_read_until_data);
+    RUN_TEST(check_ring_buffer_read_until_frame_too_long);
+    RUN_TEST(check_ring_buffer_acquire_until_with_null);
+    RUN_TEST(check_ring_buffer_acquire_until_not_found);
+    RUN_TEST(check_ring_buffer_acquire_until_with_wrap_index);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_span Run test for ring buffer front and back span functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_front_span_with_null);
+    RUN_TEST(check_ring_buffer_front_span_when_empty);
+    RUN_TEST(check_ring_buffer_front_span_data);
+    RUN_TEST(check_ring_buffer_front_span_with_wrap_index);
+    RUN_TEST(check_ring_buffer_back_span_with_null);
+    RUN_TEST(check_ring_buffer_back_span_when_full);
+    RUN_TEST(check_ring_buffer_back_span_data);
+    RUN_TEST(check_ring_buffer_back_span_with_wrap_index);
+    RUN_TEST(check_ring_buffer_back_span_commit);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_for_each Run test for ring buffer for each and iterator functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_for_each_with_null);
+    RUN_TEST(check_ring_buffer_for_each_when_empty);
+    RUN_TEST(check_ring_buffer_for_each_with_wrap_index);
+    RUN_TEST(check_ring_buffer_for_each_stop);
+    RUN_TEST(check_ring_buffer_for_each_modify);
+    RUN_TEST(check_ring_buffer_for_each_reverse_with_wrap_index);
+    RUN_TEST(check_ring_buffer_for_each_reverse_stop);
+    RUN_TEST(check_ring_buffer_iter_with_null);
+    RUN_TEST(check_ring_buffer_iter_when_empty);
+    RUN_TEST(check_ring_buffer_iter_with_wrap_index);
+    RUN_TEST(check_ring_buffer_iter_reverse_with_wrap_index);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_at Run test for ring buffer random access functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_at_with_null);
+    RUN_TEST(check_ring_buffer_at_out_of_range);
+    RUN_TEST(check_ring_buffer_at_with_wrap_index);
+    RUN_TEST(check_ring_buffer_set_with_wrap_index);
+    RUN_TEST(check_ring_buffer_at_unchecked);
+
+    /*! @} */
+
+#ifdef RING_BUFFER_STATS
+    /*! 
+     * \addtogroup ring_buffer_stats Run test for ring buffer statistics functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_stats_with_null);
+    RUN_TEST(check_ring_buffer_stats_after_init);
+    RUN_TEST(check_ring_buffer_stats_push_and_pop);
+    RUN_TEST(check_ring_buffer_stats_rejections);
+    RUN_TEST(check_ring_buffer_stats_overwrites);
+    RUN_TEST(check_ring_buffer_stats_reset);
+
+    /*! @} */
+#endif // RING_BUFFER_STATS
+
+    /*! 
+     * \addtogroup ring_buffer_init_static Run test for ring buffer static storage init
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_init_static_with_null);
+    RUN_TEST(check_ring_buffer_init_static_storage_untouched);
+    RUN_TEST(check_ring_buffer_init_static_push_and_pop);
+    RUN_TEST(check_ring_buffer_init_static_capacity);
+    RUN_TEST(check_ring_buffer_init_static_capacity_too_large);
+    RUN_TEST(check_ring_buffer_init_static_invalid_data_size);
+    RUN_TEST(check_ring_buffer_initializer);
+
+    /*! @} */
+
+    /*! 
+     * \addtogroup ring_buffer_copy_kernel Run test for ring buffer copy kernels
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_copy_kernel_selection);
+    RUN_TEST(check_ring_buffer_copy_kernel_after_init);
+    RUN_TEST(check_ring_buffer_copy_kernel_data);
+
+    /*! @} */
+
     UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,262 @@
+/*!
+ * \file test-ring-buffer-event-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the event file descriptors of the ring buffer
+ *
+ * \details The tests are run only if RING_BUFFER_EVENT is defined at compile time
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include "unity.h"
+#include "ring-buffer-event-api.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdint.h>
+#include <sys/eventfd.h>
+
+#ifdef RING_BUFFER_EVENT
+
+RingBufferHandler_t u32_buf;
+ArenaAllocatorHandler_t arena;
+
+static bool is_readable(int fd) {
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    return poll(&pfd, 1, 0) == 1 && (pfd.revents & POLLIN) != 0;
+}
+
+static eventfd_t counter(int fd) {
+    eventfd_t value = 0;
+    eventfd_read(fd, &value);
+    // Put the value back so that the state of the descriptor is unchanged
+    if (value > 0U)
+        eventfd_write(fd, value);
+    return value;
+}
+
+static int cs_enter_count;
+
+static void counting_cs_enter(void) {
+    ++cs_enter_count;
+}
+
+#endif // RING_BUFFER_EVENT
+
+void setUp(void) {
+#ifdef RING_BUFFER_EVENT
+    arena_allocator_api_init(&arena);
+    ring_buffer_api_init(&u32_buf, sizeof(uint32_t), 4, ring_buffer_cs_dummy, ring_buffer_cs_dummy, &arena);
+#endif // RING_BUFFER_EVENT
+}
+
+void tearDown(void) {
+#ifdef RING_BUFFER_EVENT
+    ring_buffer_event_api_deinit(&u32_buf);
+    arena_allocator_api_free(&arena);
+#endif // RING_BUFFER_EVENT
+}
+
+#ifdef RING_BUFFER_EVENT
+
+/*!
+ * \defgroup ring_buffer_event_init Test ring buffer event init function
+ * @{
+ */
+
+void check_ring_buffer_event_init_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_event_api_init(NULL, 0U));
+    TEST_ASSERT_EQUAL_INT(-1, ring_buffer_event_api_items_fd(NULL));
+    TEST_ASSERT_EQUAL_INT(-1, ring_buffer_event_api_space_fd(NULL));
+}
+void check_ring_buffer_event_not_initialized(void) {
+    uint32_t val = 42;
+    TEST_ASSERT_EQUAL_INT(-1, ring_buffer_event_api_items_fd(&u32_buf));
+    TEST_ASSERT_EQUAL_INT(-1, ring_buffer_event_api_space_fd(&u32_buf));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_push_back(&u32_buf, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_pop_front(&u32_buf, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_event_api_items_ack(&u32_buf));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_event_api_space_ack(&u32_buf));
+}
+void check_ring_buffer_event_init_without_threshold(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_event_api_init(&u32_buf, 0U));
+    TEST_ASSERT_GREATER_OR_EQUAL(0, ring_buffer_event_api_items_fd(&u32_buf));
+    TEST_ASSERT_EQUAL_INT(-1, ring_buffer_event_api_space_fd(&u32_buf));
+    TEST_ASSERT_FALSE(is_readable(ring_buffer_event_api_items_fd(&u32_buf)));
+}
+void check_ring_buffer_event_init_not_empty(void) {
+    uint32_t val = 42;
+    ring_buffer_api_push_back(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_event_api_init(&u32_buf, 2U));
+    TEST_ASSERT_TRUE(is_readable(ring_buffer_event_api_items_fd(&u32_buf)));
+    TEST_ASSERT_TRUE(is_readable(ring_buffer_event_api_space_fd(&u32_buf)));
+}
+
+void check_ring_buffer_event_init_twice(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_event_api_init(&u32_buf, 2U));
+    const int items_fd = ring_buffer_event_api_items_fd(&u32_buf);
+    const int space_fd = ring_buffer_event_api_space_fd(&u32_buf);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_event_api_init(&u32_buf, 3U));
+    TEST_ASSERT_GREATER_OR_EQUAL(0, ring_buffer_event_api_items_fd(&u32_buf));
+    TEST_ASSERT_GREATER_OR_EQUAL(0, ring_buffer_event_api_space_fd(&u32_buf));
+
+    // The first descriptors were closed, so nothing is left open after the deinit
+    ring_buffer_event_api_deinit(&u32_buf);
+    TEST_ASSERT_EQUAL_INT(-1, fcntl(items_fd, F_GETFD));
+    TEST_ASSERT_EQUAL_INT(-1, fcntl(space_fd, F_GETFD));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_event_items Test ring buffer event items descriptor
+ * @{
+ */
+
+void check_ring_buffer_event_items_readable_after_push(void) {
+    uint32_t val = 42;
+    ring_buffer_event_api_init(&u32_buf, 0U);
+    ring_buffer_api_push_back(&u32_buf, &val);
+    TEST_ASSERT_TRUE(is_readable(ring_buffer_event_api_items_fd(&u32_buf)));
+}
+void check_ring_buffer_event_items_coalesced(void) {
+    uint32_t val[] = { 1, 2, 3 };
+    ring_buffer_event_api_init(&u32_buf, 0U);
+    ring_buffer_api_push_back(&u32_buf, &val[0]);
+    ring_buffer_api_push_front(&u32_buf, &val[1]);
+    ring_buffer_api_push_back_n(&u32_buf, val, 2U);
+    TEST_ASSERT_EQUAL_UINT64(1U, counter(ring_buffer_event_api_items_fd(&u32_buf)));
+}
+void check_ring_buffer_event_items_not_readable_after_zero_length_push(void) {
+    uint32_t val = 42;
+    ring_buffer_event_api_init(&u32_buf, 0U);
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_api_push_back_n(&u32_buf, &val, 0U));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_commit_back(&u32_buf, 0U));
+    TEST_ASSERT_FALSE(is_readable(ring_buffer_event_api_items_fd(&u32_buf)));
+}
+void check_ring_buffer_event_items_ack_empty(void) {
+    uint32_t val = 42;
+    ring_buffer_event_api_init(&u32_buf, 0U);
+    ring_buffer_api_push_back(&u32_buf, &val);
+    ring_buffer_api_pop_front(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_event_api_items_ack(&u32_buf));
+    TEST_ASSERT_FALSE(is_readable(ring_buffer_event_api_items_fd(&u32_buf)));
+
+    ring_buffer_api_push_back(&u32_buf, &val);
+    TEST_ASSERT_TRUE(is_readable(ring_buffer_event_api_items_fd(&u32_buf)));
+}
+void check_ring_buffer_event_items_ack_not_empty(void) {
+    uint32_t val = 42;
+    ring_buffer_event_api_init(&u32_buf, 0U);
+    ring_buffer_api_push_back(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_event_api_items_ack(&u32_buf));
+    TEST_ASSERT_TRUE(is_readable(ring_buffer_event_api_items_fd(&u32_buf)));
+    TEST_ASSERT_EQUAL_UINT64(1U, counter(ring_buffer_event_api_items_fd(&u32_buf)));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_event_space Test ring buffer event space descriptor
+ * @{
+ */
+
+void check_ring_buffer_event_space_below_threshold(void) {
+    uint32_t val[] = { 1, 2, 3, 4 };
+    ring_buffer_api_push_back_n(&u32_buf, val, 4U);
+    ring_buffer_event_api_init(&u32_buf, 2U);
+    TEST_ASSERT_FALSE(is_readable(ring_buffer_event_api_space_fd(&u32_buf)));
+
+    ring_buffer_api_pop_front(&u32_buf, NULL);
+    ring_buffer_api_pop_back(&u32_buf, NULL);
+    TEST_ASSERT_FALSE(is_readable(ring_buffer_event_api_space_fd(&u32_buf)));
+    ring_buffer_api_pop_front(&u32_buf, NULL);
+    TEST_ASSERT_TRUE(is_readable(ring_buffer_event_api_space_fd(&u32_buf)));
+}
+void check_ring_buffer_event_space_coalesced(void) {
+    uint32_t val[] = { 1, 2, 3, 4 };
+    ring_buffer_api_push_back_n(&u32_buf, val, 4U);
+    ring_buffer_event_api_init(&u32_buf, 4U);
+    ring_buffer_api_pop_front(&u32_buf, NULL);
+    ring_buffer_api_pop_front_n(&u32_buf, NULL, 2U);
+    ring_buffer_api_clear(&u32_buf);
+    TEST_ASSERT_EQUAL_UINT64(1U, counter(ring_buffer_event_api_space_fd(&u32_buf)));
+}
+void check_ring_buffer_event_space_single_critical_section(void) {
+    uint32_t val[] = { 1, 2, 3, 4 };
+    ring_buffer_api_push_back_n(&u32_buf, val, 4U);
+    ring_buffer_event_api_init(&u32_buf, 2U);
+    u32_buf.cs_enter = counting_cs_enter;
+    cs_enter_count = 0;
+    ring_buffer_api_pop_front(&u32_buf, NULL);
+    ring_buffer_api_pop_front(&u32_buf, NULL);
+    ring_buffer_api_pop_front(&u32_buf, NULL);
+    TEST_ASSERT_EQUAL_INT(3, cs_enter_count);
+    TEST_ASSERT_TRUE(is_readable(ring_buffer_event_api_space_fd(&u32_buf)));
+}
+void check_ring_buffer_event_space_ack(void) {
+    uint32_t val[] = { 1, 2, 3, 4 };
+    ring_buffer_event_api_init(&u32_buf, 2U);
+    TEST_ASSERT_TRUE(is_readable(ring_buffer_event_api_space_fd(&u32_buf)));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_event_api_space_ack(&u32_buf));
+    TEST_ASSERT_TRUE(is_readable(ring_buffer_event_api_space_fd(&u32_buf)));
+
+    ring_buffer_api_push_back_n(&u32_buf, val, 3U);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_event_api_space_ack(&u32_buf));
+    TEST_ASSERT_FALSE(is_readable(ring_buffer_event_api_space_fd(&u32_buf)));
+}
+
+/*! @} */
+
+#endif // RING_BUFFER_EVENT
+
+int main() {
+    UNITY_BEGIN();
+
+#ifdef RING_BUFFER_EVENT
+    /*!
+     * \addtogroup ring_buffer_event_init Run test for ring buffer event init function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_event_init_with_null);
+    RUN_TEST(check_ring_buffer_event_not_initialized);
+    RUN_TEST(check_ring_buffer_event_init_without_threshold);
+    RUN_TEST(check_ring_buffer_event_init_not_empty);
+    RUN_TEST(check_ring_buffer_event_init_twice);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_event_items Run test for ring buffer event items descriptor
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_event_items_readable_after_push);
+    RUN_TEST(check_ring_buffer_event_items_coalesced);
+    RUN_TEST(check_ring_buffer_event_items_not_readable_after_zero_length_push);
+    RUN_TEST(check_ring_buffer_event_items_ack_empty);
+    RUN_TEST(check_ring_buffer_event_items_ack_not_empty);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_event_space Run test for ring buffer event space descriptor
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_event_space_below_threshold);
+    RUN_TEST(check_ring_buffer_event_space_coalesced);
+    RUN_TEST(check_ring_buffer_event_space_single_critical_section);
+    RUN_TEST(check_ring_buffer_event_space_ack);
+
+    /*! @} */
+#endif // RING_BUFFER_EVENT
+
+    UNITY_END();
+}
@@ -0,0 +1,97 @@
+/*!
+ * \file test-ring-buffer-inline-data-size.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the header-only inline ring buffer functions with a
+ *      constant item size
+ *
+ * \details The header is included with RING_BUFFER_INLINE_NO_LOCK and
+ *      RING_BUFFER_INLINE_DATA_SIZE defined as in its documented example, so
+ *      that the slot addressing and the copies use the constant item size
+ */
+
+#include <stdint.h>
+
+#define RING_BUFFER_INLINE_NO_LOCK
+#define RING_BUFFER_INLINE_DATA_SIZE(buffer) sizeof(uint32_t)
+
+#include "unity.h"
+#include "ring-buffer-inline.h"
+
+RingBufferHandler_t u32_buf;
+ArenaAllocatorHandler_t arena;
+
+void setUp(void) {
+    arena_allocator_api_init(&arena);
+    ring_buffer_api_init(&u32_buf, sizeof(uint32_t), 4, NULL, NULL, &arena);
+}
+
+void tearDown(void) {
+    arena_allocator_api_free(&arena);
+}
+
+/*!
+ * \defgroup ring_buffer_inline_data_size Test inline functions with a constant item size
+ * @{
+ */
+
+void check_ring_buffer_inline_data_size_push_slots(void) {
+    uint32_t val = 0xA5A5A5A5U;
+    u32_buf.start = u32_buf.capacity - 1;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_push_back(&u32_buf, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_push_back(&u32_buf, &val));
+    TEST_ASSERT_EQUAL_UINT32(val, ((uint32_t *)u32_buf.data)[u32_buf.capacity - 1]);
+    TEST_ASSERT_EQUAL_UINT32(val, ((uint32_t *)u32_buf.data)[0]);
+}
+void check_ring_buffer_inline_data_size_order(void) {
+    uint32_t out;
+    u32_buf.start = u32_buf.capacity - 2;
+    for (uint32_t i = 1; i < 4; ++i)
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_push_back(&u32_buf, &i));
+    uint32_t val = 0;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_push_front(&u32_buf, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_inline_push_back(&u32_buf, &val));
+
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_front(&u32_buf, &out));
+    TEST_ASSERT_EQUAL_UINT32(0U, out);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_back(&u32_buf, &out));
+    TEST_ASSERT_EQUAL_UINT32(3U, out);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_pop_back(&u32_buf, &out));
+    TEST_ASSERT_EQUAL_UINT32(3U, out);
+    for (uint32_t i = 0; i < 3; ++i) {
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_pop_front(&u32_buf, &out));
+        TEST_ASSERT_EQUAL_UINT32(i, out);
+    }
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_inline_pop_front(&u32_buf, &out));
+}
+void check_ring_buffer_inline_data_size_mixed_with_api(void) {
+    uint32_t out;
+    for (uint32_t i = 0; i < 3; ++i)
+        ring_buffer_api_push_back(&u32_buf, &i);
+    ring_buffer_api_pop_front(&u32_buf, &out);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_pop_front(&u32_buf, &out));
+    TEST_ASSERT_EQUAL_UINT32(1U, out);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_back(&u32_buf, &out));
+    TEST_ASSERT_EQUAL_UINT32(2U, out);
+}
+
+/*! @} */
+
+int main() {
+    UNITY_BEGIN();
+
+    /*!
+     * \addtogroup ring_buffer_inline_data_size Run test for inline functions with a constant item size
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_inline_data_size_push_slots);
+    RUN_TEST(check_ring_buffer_inline_data_size_order);
+    RUN_TEST(check_ring_buffer_inline_data_size_mixed_with_api);
+
+    /*! @} */
+
+    UNITY_END();
+}
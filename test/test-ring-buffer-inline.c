@@ -0,0 +1,149 @@
+/*!
+ * \file test-ring-buffer-inline.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the header-only inline ring buffer functions
+ *
+ * \details The critical section is replaced at compile time by counters, to
+ *      check that the compile time policy is used instead of cs_enter and
+ *      cs_exit of the buffer
+ */
+
+#include <stdint.h>
+
+static int inline_enter_count;
+static int inline_exit_count;
+
+#define RING_BUFFER_INLINE_CS_ENTER(buffer) ((void)(buffer), ++inline_enter_count)
+#define RING_BUFFER_INLINE_CS_EXIT(buffer) ((void)(buffer), ++inline_exit_count)
+
+#include "unity.h"
+#include "ring-buffer-inline.h"
+
+RingBufferHandler_t int_buf;
+ArenaAllocatorHandler_t arena;
+static int cs_enter_count;
+
+static void cs_enter(void) {
+    ++cs_enter_count;
+}
+
+static void cs_exit(void) {
+}
+
+void setUp(void) {
+    inline_enter_count = 0;
+    inline_exit_count = 0;
+    cs_enter_count = 0;
+    arena_allocator_api_init(&arena);
+    ring_buffer_api_init(&int_buf, sizeof(int), 4, cs_enter, cs_exit, &arena);
+}
+
+void tearDown(void) {
+    arena_allocator_api_free(&arena);
+}
+
+/*!
+ * \defgroup ring_buffer_inline_push Test inline push functions
+ * @{
+ */
+
+void check_ring_buffer_inline_push_with_null(void) {
+    int val = 42;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_inline_push_back(NULL, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_inline_push_back(&int_buf, NULL));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_inline_push_front(NULL, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_inline_push_front(&int_buf, NULL));
+}
+void check_ring_buffer_inline_push_back_when_full(void) {
+    int val = 42;
+    for (size_t i = 0; i < int_buf.capacity; ++i)
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_push_back(&int_buf, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_inline_push_back(&int_buf, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_inline_push_front(&int_buf, &val));
+}
+void check_ring_buffer_inline_push_order(void) {
+    int out;
+    for (int i = 0; i < 3; ++i)
+        ring_buffer_inline_push_back(&int_buf, &i);
+    int val = -1;
+    ring_buffer_inline_push_front(&int_buf, &val);
+    for (int i = -1; i < 3; ++i) {
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_pop_front(&int_buf, &out));
+        TEST_ASSERT_EQUAL_INT(i, out);
+    }
+}
+void check_ring_buffer_inline_compile_time_lock(void) {
+    int val = 42;
+    ring_buffer_inline_push_back(&int_buf, &val);
+    ring_buffer_inline_pop_front(&int_buf, &val);
+    TEST_ASSERT_EQUAL_INT(2, inline_enter_count);
+    TEST_ASSERT_EQUAL_INT(2, inline_exit_count);
+    TEST_ASSERT_EQUAL_INT(0, cs_enter_count);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_inline_pop Test inline pop and access functions
+ * @{
+ */
+
+void check_ring_buffer_inline_pop_when_empty(void) {
+    int out;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_inline_pop_front(NULL, &out));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_inline_pop_front(&int_buf, &out));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_inline_pop_back(&int_buf, &out));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_inline_front(&int_buf, &out));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_inline_back(&int_buf, &out));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_inline_front(&int_buf, NULL));
+}
+void check_ring_buffer_inline_pop_with_wrap_index(void) {
+    int out;
+    int_buf.start = int_buf.capacity - 1;
+    for (int i = 0; i < 3; ++i)
+        ring_buffer_api_push_back(&int_buf, &i);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_front(&int_buf, &out));
+    TEST_ASSERT_EQUAL_INT(0, out);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_back(&int_buf, &out));
+    TEST_ASSERT_EQUAL_INT(2, out);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_pop_back(&int_buf, &out));
+    TEST_ASSERT_EQUAL_INT(2, out);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_pop_front(&int_buf, &out));
+    TEST_ASSERT_EQUAL_INT(0, out);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_inline_pop_front(&int_buf, NULL));
+    TEST_ASSERT_TRUE(ring_buffer_api_is_empty(&int_buf));
+    TEST_ASSERT_EQUAL_size_t(1U, int_buf.start);
+}
+
+/*! @} */
+
+int main() {
+    UNITY_BEGIN();
+
+    /*!
+     * \addtogroup ring_buffer_inline_push Run test for inline push functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_inline_push_with_null);
+    RUN_TEST(check_ring_buffer_inline_push_back_when_full);
+    RUN_TEST(check_ring_buffer_inline_push_order);
+    RUN_TEST(check_ring_buffer_inline_compile_time_lock);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_inline_pop Run test for inline pop and access functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_inline_pop_when_empty);
+    RUN_TEST(check_ring_buffer_inline_pop_with_wrap_index);
+
+    /*! @} */
+
+    UNITY_END();
+}
@@ -0,0 +1,189 @@
+/*!
+ * \file test-ring-buffer-lock-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the per-buffer lock policies
+ *
+ * \details Other than the single thread tests, a stress test runs multiple
+ *      threads that push and pop on the same buffer with each lock and checks
+ *      that every item is received exactly once.
+ */
+
+#include "unity.h"
+#include "ring-buffer-lock-api.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+
+#define STRESS_THREADS (4U)
+#define STRESS_ITEMS (20000U)
+
+typedef struct {
+    int enter;
+    int exit;
+} LockCounter;
+
+RingBufferHandler_t u32_buf;
+ArenaAllocatorHandler_t arena;
+
+static void counter_enter(void *ctx) {
+    ++((LockCounter *)ctx)->enter;
+}
+
+static void counter_exit(void *ctx) {
+    ++((LockCounter *)ctx)->exit;
+}
+
+static const RingBufferLockPolicy_t counter_policy = { .enter = counter_enter, .exit = counter_exit };
+
+void setUp(void) {
+    arena_allocator_api_init(&arena);
+    ring_buffer_api_init(&u32_buf, sizeof(uint32_t), 16, NULL, NULL, &arena);
+}
+
+void tearDown(void) {
+    arena_allocator_api_free(&arena);
+}
+
+/*!
+ * \defgroup ring_buffer_set_lock Test ring buffer set lock function
+ * @{
+ */
+
+void check_ring_buffer_set_lock_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_set_lock(NULL, &counter_policy, NULL));
+}
+void check_ring_buffer_set_lock_after_init(void) {
+    TEST_ASSERT_NULL(u32_buf.lock);
+    TEST_ASSERT_NULL(u32_buf.lock_ctx);
+}
+void check_ring_buffer_set_lock_calls_policy(void) {
+    LockCounter counter = { 0, 0 };
+    uint32_t val = 42;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_set_lock(&u32_buf, &counter_policy, &counter));
+    ring_buffer_api_push_back(&u32_buf, &val);
+    ring_buffer_api_pop_front(&u32_buf, &val);
+    ring_buffer_api_pop_front(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_INT(3, counter.enter);
+    TEST_ASSERT_EQUAL_INT(3, counter.exit);
+}
+void check_ring_buffer_set_lock_remove(void) {
+    LockCounter counter = { 0, 0 };
+    uint32_t val = 42;
+    ring_buffer_api_set_lock(&u32_buf, &counter_policy, &counter);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_set_lock(&u32_buf, NULL, NULL));
+    ring_buffer_api_push_back(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_INT(0, counter.enter);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_lock_policies Test built-in lock policies
+ * @{
+ */
+
+typedef struct {
+    RingBufferHandler_t *buffer;
+    uint32_t id;
+    uint64_t sum;
+} StressArgs;
+
+static void *stress_thread(void *arg) {
+    StressArgs *args = (StressArgs *)arg;
+    for (uint32_t i = 0; i < STRESS_ITEMS; ++i) {
+        uint32_t val = args->id * STRESS_ITEMS + i;
+        while (ring_buffer_api_push_back(args->buffer, &val) != RING_BUFFER_OK)
+            sched_yield();
+        while (ring_buffer_api_pop_front(args->buffer, &val) != RING_BUFFER_OK)
+            sched_yield();
+        args->sum += val;
+    }
+    return NULL;
+}
+
+static void stress(const RingBufferLockPolicy_t *policy, void *lock) {
+    pthread_t threads[STRESS_THREADS];
+    StressArgs args[STRESS_THREADS];
+    ring_buffer_api_set_lock(&u32_buf, policy, lock);
+    for (uint32_t t = 0; t < STRESS_THREADS; ++t) {
+        args[t] = (StressArgs){ &u32_buf, t, 0U };
+        pthread_create(&threads[t], NULL, stress_thread, &args[t]);
+    }
+    uint64_t sum = 0U;
+    for (uint32_t t = 0; t < STRESS_THREADS; ++t) {
+        pthread_join(threads[t], NULL);
+        sum += args[t].sum;
+    }
+    const uint64_t n = (uint64_t)STRESS_THREADS * STRESS_ITEMS;
+    TEST_ASSERT_EQUAL_UINT64(n * (n - 1U) / 2U, sum);
+    TEST_ASSERT_TRUE(ring_buffer_api_is_empty(&u32_buf));
+}
+
+void check_ring_buffer_lock_spinlock(void) {
+    RingBufferSpinlock_t lock;
+    ring_buffer_lock_api_spinlock_init(&lock);
+    ring_buffer_lock_spinlock.enter(&lock);
+    TEST_ASSERT_TRUE(atomic_load(&lock.locked));
+    ring_buffer_lock_spinlock.exit(&lock);
+    TEST_ASSERT_FALSE(atomic_load(&lock.locked));
+}
+void check_ring_buffer_lock_ticket(void) {
+    RingBufferTicketLock_t lock;
+    ring_buffer_lock_api_ticket_init(&lock);
+    ring_buffer_lock_ticket.enter(&lock);
+    TEST_ASSERT_EQUAL_UINT32(1U, atomic_load(&lock.next));
+    TEST_ASSERT_EQUAL_UINT32(0U, atomic_load(&lock.serving));
+    ring_buffer_lock_ticket.exit(&lock);
+    TEST_ASSERT_EQUAL_UINT32(1U, atomic_load(&lock.serving));
+}
+void check_ring_buffer_lock_spinlock_stress(void) {
+    RingBufferSpinlock_t lock;
+    ring_buffer_lock_api_spinlock_init(&lock);
+    stress(&ring_buffer_lock_spinlock, &lock);
+}
+void check_ring_buffer_lock_ticket_stress(void) {
+    RingBufferTicketLock_t lock;
+    ring_buffer_lock_api_ticket_init(&lock);
+    stress(&ring_buffer_lock_ticket, &lock);
+}
+void check_ring_buffer_lock_pthread_mutex_stress(void) {
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    stress(&ring_buffer_lock_pthread_mutex, &lock);
+}
+
+/*! @} */
+
+int main() {
+    UNITY_BEGIN();
+
+    /*!
+     * \addtogroup ring_buffer_set_lock Run test for ring buffer set lock function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_set_lock_with_null);
+    RUN_TEST(check_ring_buffer_set_lock_after_init);
+    RUN_TEST(check_ring_buffer_set_lock_calls_policy);
+    RUN_TEST(check_ring_buffer_set_lock_remove);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_lock_policies Run test for built-in lock policies
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_lock_spinlock);
+    RUN_TEST(check_ring_buffer_lock_ticket);
+    RUN_TEST(check_ring_buffer_lock_spinlock_stress);
+    RUN_TEST(check_ring_buffer_lock_ticket_stress);
+    RUN_TEST(check_ring_buffer_lock_pthread_mutex_stress);
+
+    /*! @} */
+
+    UNITY_END();
+}
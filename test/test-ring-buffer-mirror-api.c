@@ -0,0 +1,203 @@
+/*!
+ * \file test-ring-buffer-mirror-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the ring buffer backend with mirrored memory mapping
+ */
+
+#include "unity.h"
+#include "ring-buffer-mirror-api.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+RingBufferHandler_t byte_buf;
+RingBufferHandler_t u32_buf;
+
+void setUp(void) {
+    ring_buffer_mirror_api_init(&byte_buf, sizeof(uint8_t), 100, NULL, NULL);
+    ring_buffer_mirror_api_init(&u32_buf, sizeof(uint32_t), 10, NULL, NULL);
+}
+
+void tearDown(void) {
+    ring_buffer_mirror_api_deinit(&byte_buf);
+    ring_buffer_mirror_api_deinit(&u32_buf);
+}
+
+/*!
+ * \defgroup ring_buffer_mirror_init Test mirrored ring buffer initialization
+ * @{
+ */
+
+void check_ring_buffer_mirror_init_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_mirror_api_init(NULL, sizeof(uint8_t), 100, NULL, NULL));
+}
+void check_ring_buffer_mirror_init_with_zero_data_size(void) {
+    RingBufferHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_mirror_api_init(&buf, 0U, 100, NULL, NULL));
+}
+void check_ring_buffer_mirror_init_data_size_too_large(void) {
+    RingBufferHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_mirror_api_init(&buf, RING_BUFFER_MAX_DATA_SIZE + 1U, 1, NULL, NULL));
+}
+void check_ring_buffer_mirror_init_capacity_too_large(void) {
+    RingBufferHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_mirror_api_init(&buf, sizeof(uint8_t), SIZE_MAX, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_mirror_api_init(&buf, 12U, SIZE_MAX / 12U, NULL, NULL));
+}
+void check_ring_buffer_mirror_init_capacity_page_multiple(void) {
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    TEST_ASSERT_EQUAL_size_t(0U, (byte_buf.capacity * byte_buf.data_size) % page);
+    TEST_ASSERT_TRUE(byte_buf.capacity >= 100U);
+}
+void check_ring_buffer_mirror_init_capacity_odd_data_size(void) {
+    RingBufferHandler_t buf;
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_mirror_api_init(&buf, 12U, 10, NULL, NULL));
+    TEST_ASSERT_EQUAL_size_t(0U, (buf.capacity * buf.data_size) % page);
+    ring_buffer_mirror_api_deinit(&buf);
+}
+void check_ring_buffer_mirror_init_same_fields_as_static(void) {
+    RingBufferHandler_t expected;
+    ring_buffer_api_init_static(&expected, byte_buf.data_size, byte_buf.capacity, NULL, NULL, byte_buf.data);
+    TEST_ASSERT_EQUAL_size_t(expected.start, byte_buf.start);
+    TEST_ASSERT_EQUAL_size_t(expected.size, byte_buf.size);
+    TEST_ASSERT_EQUAL_size_t(expected.capacity, byte_buf.capacity);
+    TEST_ASSERT_TRUE(expected.cs_enter == byte_buf.cs_enter);
+    TEST_ASSERT_TRUE(expected.cs_exit == byte_buf.cs_exit);
+    TEST_ASSERT_TRUE(expected.copy == byte_buf.copy);
+    TEST_ASSERT_NULL(byte_buf.lock);
+    TEST_ASSERT_NULL(byte_buf.lock_ctx);
+}
+void check_ring_buffer_mirror_init_data_mirrored(void) {
+    uint8_t *data = (uint8_t *)byte_buf.data;
+    data[0] = 0x42;
+    TEST_ASSERT_EQUAL_UINT8(0x42, data[byte_buf.capacity]);
+    data[byte_buf.capacity + 1] = 0x24;
+    TEST_ASSERT_EQUAL_UINT8(0x24, data[1]);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_mirror_deinit Test mirrored ring buffer deinitialization
+ * @{
+ */
+
+void check_ring_buffer_mirror_deinit_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_mirror_api_deinit(NULL));
+}
+void check_ring_buffer_mirror_deinit_data(void) {
+    RingBufferHandler_t buf;
+    ring_buffer_mirror_api_init(&buf, sizeof(uint8_t), 100, NULL, NULL);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_mirror_api_deinit(&buf));
+    TEST_ASSERT_NULL(buf.data);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_mirror_api_deinit(&buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_mirror_span Test mirrored ring buffer span functions
+ * @{
+ */
+
+void check_ring_buffer_mirror_front_span_with_null(void) {
+    size_t count;
+    TEST_ASSERT_NULL(ring_buffer_mirror_api_front_span(NULL, &count));
+    TEST_ASSERT_NULL(ring_buffer_mirror_api_front_span(&byte_buf, NULL));
+}
+void check_ring_buffer_mirror_front_span_when_empty(void) {
+    size_t count = 1;
+    TEST_ASSERT_NULL(ring_buffer_mirror_api_front_span(&byte_buf, &count));
+    TEST_ASSERT_EQUAL_size_t(0U, count);
+}
+void check_ring_buffer_mirror_front_span_with_wrap(void) {
+    const uint32_t items[4] = { 1, 2, 3, 4 };
+    u32_buf.start = u32_buf.capacity - 2;
+    ring_buffer_api_push_back_n(&u32_buf, items, 4);
+
+    size_t count = 0;
+    uint32_t *front = ring_buffer_mirror_api_front_span(&u32_buf, &count);
+    TEST_ASSERT_EQUAL_PTR(&((uint32_t *)u32_buf.data)[u32_buf.capacity - 2], front);
+    TEST_ASSERT_EQUAL_size_t(4U, count);
+    TEST_ASSERT_EQUAL_MEMORY(items, front, sizeof(items));
+}
+void check_ring_buffer_mirror_back_span_with_null(void) {
+    size_t count;
+    TEST_ASSERT_NULL(ring_buffer_mirror_api_back_span(NULL, &count));
+    TEST_ASSERT_NULL(ring_buffer_mirror_api_back_span(&byte_buf, NULL));
+}
+void check_ring_buffer_mirror_back_span_when_full(void) {
+    size_t count = 1;
+    byte_buf.size = byte_buf.capacity;
+    TEST_ASSERT_NULL(ring_buffer_mirror_api_back_span(&byte_buf, &count));
+    TEST_ASSERT_EQUAL_size_t(0U, count);
+}
+void check_ring_buffer_mirror_back_span_with_wrap(void) {
+    const uint32_t items[4] = { 1, 2, 3, 4 };
+    u32_buf.start = u32_buf.capacity - 2;
+    u32_buf.size = 1;
+
+    size_t count = 0;
+    uint32_t *back = ring_buffer_mirror_api_back_span(&u32_buf, &count);
+    TEST_ASSERT_EQUAL_size_t(u32_buf.capacity - 1, count);
+    memcpy(back, items, sizeof(items));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_commit_back(&u32_buf, 4));
+
+    uint32_t out[4] = { 0 };
+    ring_buffer_api_pop_front(&u32_buf, NULL);
+    TEST_ASSERT_EQUAL_size_t(4U, ring_buffer_api_pop_front_n(&u32_buf, out, 4));
+    TEST_ASSERT_EQUAL_MEMORY(items, out, sizeof(items));
+}
+
+/*! @} */
+
+int main() {
+    UNITY_BEGIN();
+
+    /*!
+     * \addtogroup ring_buffer_mirror_init Run test for mirrored ring buffer initialization
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_mirror_init_with_null);
+    RUN_TEST(check_ring_buffer_mirror_init_with_zero_data_size);
+    RUN_TEST(check_ring_buffer_mirror_init_data_size_too_large);
+    RUN_TEST(check_ring_buffer_mirror_init_capacity_too_large);
+    RUN_TEST(check_ring_buffer_mirror_init_capacity_page_multiple);
+    RUN_TEST(check_ring_buffer_mirror_init_capacity_odd_data_size);
+    RUN_TEST(check_ring_buffer_mirror_init_same_fields_as_static);
+    RUN_TEST(check_ring_buffer_mirror_init_data_mirrored);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_mirror_deinit Run test for mirrored ring buffer deinitialization
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_mirror_deinit_with_null);
+    RUN_TEST(check_ring_buffer_mirror_deinit_data);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_mirror_span Run test for mirrored ring buffer span functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_mirror_front_span_with_null);
+    RUN_TEST(check_ring_buffer_mirror_front_span_when_empty);
+    RUN_TEST(check_ring_buffer_mirror_front_span_with_wrap);
+    RUN_TEST(check_ring_buffer_mirror_back_span_with_null);
+    RUN_TEST(check_ring_buffer_mirror_back_span_when_full);
+    RUN_TEST(check_ring_buffer_mirror_back_span_with_wrap);
+
+    /*! @} */
+
+    UNITY_END();
+}
@@ -0,0 +1,293 @@
+/*!
+ * \file test-ring-buffer-mpmc-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the lock-free multi-producer/multi-consumer ring buffer
+ *
+ * \details Other than the single thread tests of each function, a stress test
+ *      runs multiple producer and consumer threads concurrently and checks
+ *      that every item is received exactly once.
+ */
+
+#include "unity.h"
+#include "ring-buffer-mpmc-api.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <string.h>
+
+#define STRESS_THREADS (4U)
+#define STRESS_ITEMS (20000U)
+
+typedef struct {
+    float x, y;
+} Point;
+
+RingBufferMpmcHandler_t point_buf;
+RingBufferMpmcHandler_t u32_buf;
+ArenaAllocatorHandler_t arena;
+
+void setUp(void) {
+    arena_allocator_api_init(&arena);
+    ring_buffer_mpmc_api_init(&point_buf, sizeof(Point), 8, &arena);
+    ring_buffer_mpmc_api_init(&u32_buf, sizeof(uint32_t), 64, &arena);
+}
+
+void tearDown(void) {
+    arena_allocator_api_free(&arena);
+}
+
+/*!
+ * \defgroup ring_buffer_mpmc_init Test lock-free ring buffer initialization
+ * @{
+ */
+
+void check_ring_buffer_mpmc_init_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_mpmc_api_init(NULL, sizeof(float), 3, &arena));
+}
+void check_ring_buffer_mpmc_init_with_null_arena(void) {
+    RingBufferMpmcHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_mpmc_api_init(&buf, sizeof(float), 3, NULL));
+}
+void check_ring_buffer_mpmc_init_return_value(void) {
+    RingBufferMpmcHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_mpmc_api_init(&buf, sizeof(float), 3, &arena));
+}
+void check_ring_buffer_mpmc_init_capacity_rounded(void) {
+    RingBufferMpmcHandler_t buf;
+    ring_buffer_mpmc_api_init(&buf, sizeof(float), 5, &arena);
+    TEST_ASSERT_EQUAL_size_t(8U, ring_buffer_mpmc_api_capacity(&buf));
+}
+void check_ring_buffer_mpmc_init_capacity_minimum(void) {
+    RingBufferMpmcHandler_t buf;
+    ring_buffer_mpmc_api_init(&buf, sizeof(float), 1, &arena);
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_mpmc_api_capacity(&buf));
+}
+void check_ring_buffer_mpmc_init_capacity_too_large(void) {
+    RingBufferMpmcHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_mpmc_api_init(&buf, sizeof(float), SIZE_MAX, &arena));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_mpmc_api_init(&buf, sizeof(float), (SIZE_MAX >> 1) + 1U, &arena));
+}
+void check_ring_buffer_mpmc_init_invalid_data_size(void) {
+    RingBufferMpmcHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_mpmc_api_init(&buf, 0U, 4, &arena));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_mpmc_api_init(&buf, RING_BUFFER_MAX_DATA_SIZE + 1U, 4, &arena));
+}
+void check_ring_buffer_mpmc_init_empty(void) {
+    TEST_ASSERT_TRUE(ring_buffer_mpmc_api_is_empty(&point_buf));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_mpmc_api_size(&point_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_mpmc_push_back Test lock-free ring buffer push back function
+ * @{
+ */
+
+void check_ring_buffer_mpmc_push_back_with_null_handler(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_mpmc_api_push_back(NULL, &p));
+}
+void check_ring_buffer_mpmc_push_back_with_null_item(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_mpmc_api_push_back(&point_buf, NULL));
+}
+void check_ring_buffer_mpmc_push_back_when_full(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    for (size_t i = 0; i < 8; ++i)
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_mpmc_api_push_back(&point_buf, &p));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_mpmc_api_push_back(&point_buf, &p));
+    TEST_ASSERT_EQUAL_size_t(8U, ring_buffer_mpmc_api_size(&point_buf));
+}
+void check_ring_buffer_mpmc_push_back_data(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    ring_buffer_mpmc_api_push_back(&point_buf, &p);
+    TEST_ASSERT_EQUAL_MEMORY(&p, &((Point *)point_buf.data)[0], sizeof(Point));
+    TEST_ASSERT_EQUAL_size_t(1U, atomic_load(&point_buf.sequences[0]));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_mpmc_pop_front Test lock-free ring buffer pop front function
+ * @{
+ */
+
+void check_ring_buffer_mpmc_pop_front_with_null_handler(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_mpmc_api_pop_front(NULL, &p));
+}
+void check_ring_buffer_mpmc_pop_front_with_null_item(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    ring_buffer_mpmc_api_push_back(&point_buf, &p);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_mpmc_api_pop_front(&point_buf, NULL));
+    TEST_ASSERT_TRUE(ring_buffer_mpmc_api_is_empty(&point_buf));
+}
+void check_ring_buffer_mpmc_pop_front_when_empty(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_mpmc_api_pop_front(&point_buf, &p));
+}
+void check_ring_buffer_mpmc_pop_front_data(void) {
+    Point dot = { .x = 69.69f, .y = 2.7f };
+    Point p = { 0 };
+    ring_buffer_mpmc_api_push_back(&point_buf, &dot);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_mpmc_api_pop_front(&point_buf, &p));
+    TEST_ASSERT_EQUAL_MEMORY(&dot, &p, sizeof(Point));
+    TEST_ASSERT_EQUAL_size_t(8U, atomic_load(&point_buf.sequences[0]));
+}
+void check_ring_buffer_mpmc_pop_front_with_wrap(void) {
+    for (uint32_t i = 0; i < 200; ++i) {
+        ring_buffer_mpmc_api_push_back(&u32_buf, &i);
+        uint32_t val = UINT32_MAX;
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_mpmc_api_pop_front(&u32_buf, &val));
+        TEST_ASSERT_EQUAL_UINT32(i, val);
+    }
+    TEST_ASSERT_TRUE(ring_buffer_mpmc_api_is_empty(&u32_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_mpmc_layout Test lock-free ring buffer handler layout
+ * @{
+ */
+
+#if RING_BUFFER_CACHE_LINE_SIZE > 0
+void check_ring_buffer_mpmc_layout_separate_lines(void) {
+    const size_t line = RING_BUFFER_CACHE_LINE_SIZE;
+    TEST_ASSERT_NOT_EQUAL(offsetof(RingBufferMpmcHandler_t, mask) / line, offsetof(RingBufferMpmcHandler_t, head) / line);
+    TEST_ASSERT_NOT_EQUAL(offsetof(RingBufferMpmcHandler_t, mask) / line, offsetof(RingBufferMpmcHandler_t, tail) / line);
+    TEST_ASSERT_NOT_EQUAL(offsetof(RingBufferMpmcHandler_t, head) / line, offsetof(RingBufferMpmcHandler_t, tail) / line);
+    TEST_ASSERT_EQUAL_size_t(offsetof(RingBufferMpmcHandler_t, mask) / line, offsetof(RingBufferMpmcHandler_t, data) / line);
+    TEST_ASSERT_EQUAL_size_t(0U, sizeof(RingBufferMpmcHandler_t) % line);
+}
+#endif // RING_BUFFER_CACHE_LINE_SIZE > 0
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_mpmc_stress Test lock-free ring buffer with concurrent threads
+ * @{
+ */
+
+static uint8_t received[STRESS_THREADS * STRESS_ITEMS];
+static atomic_uint received_count;
+
+static void *stress_producer(void *arg) {
+    const uint32_t first = (uint32_t)(uintptr_t)arg * STRESS_ITEMS;
+    for (uint32_t i = first; i < first + STRESS_ITEMS; ++i) {
+        while (ring_buffer_mpmc_api_push_back(&u32_buf, &i) != RING_BUFFER_OK)
+            sched_yield();
+    }
+    return NULL;
+}
+
+static void *stress_consumer(void *arg) {
+    (void)arg;
+    while (atomic_load(&received_count) < STRESS_THREADS * STRESS_ITEMS) {
+        uint32_t val;
+        if (ring_buffer_mpmc_api_pop_front(&u32_buf, &val) != RING_BUFFER_OK) {
+            sched_yield();
+            continue;
+        }
+        ++received[val];
+        atomic_fetch_add(&received_count, 1U);
+    }
+    return NULL;
+}
+
+void check_ring_buffer_mpmc_stress_multiple_threads(void) {
+    pthread_t producers[STRESS_THREADS];
+    pthread_t consumers[STRESS_THREADS];
+    memset(received, 0, sizeof(received));
+    atomic_store(&received_count, 0U);
+
+    for (uintptr_t i = 0; i < STRESS_THREADS; ++i) {
+        pthread_create(&producers[i], NULL, stress_producer, (void *)i);
+        pthread_create(&consumers[i], NULL, stress_consumer, NULL);
+    }
+    for (size_t i = 0; i < STRESS_THREADS; ++i) {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+
+    uint32_t errors = 0;
+    for (size_t i = 0; i < STRESS_THREADS * STRESS_ITEMS; ++i) {
+        if (received[i] != 1U)
+            ++errors;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, errors);
+    TEST_ASSERT_TRUE(ring_buffer_mpmc_api_is_empty(&u32_buf));
+}
+
+/*! @} */
+
+int main() {
+    UNITY_BEGIN();
+
+    /*!
+     * \addtogroup ring_buffer_mpmc_init Run test for lock-free ring buffer initialization
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_mpmc_init_with_null);
+    RUN_TEST(check_ring_buffer_mpmc_init_with_null_arena);
+    RUN_TEST(check_ring_buffer_mpmc_init_return_value);
+    RUN_TEST(check_ring_buffer_mpmc_init_capacity_rounded);
+    RUN_TEST(check_ring_buffer_mpmc_init_capacity_minimum);
+    RUN_TEST(check_ring_buffer_mpmc_init_capacity_too_large);
+    RUN_TEST(check_ring_buffer_mpmc_init_invalid_data_size);
+    RUN_TEST(check_ring_buffer_mpmc_init_empty);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_mpmc_push_back Run test for lock-free ring buffer push back function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_mpmc_push_back_with_null_handler);
+    RUN_TEST(check_ring_buffer_mpmc_push_back_with_null_item);
+    RUN_TEST(check_ring_buffer_mpmc_push_back_when_full);
+    RUN_TEST(check_ring_buffer_mpmc_push_back_data);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_mpmc_pop_front Run test for lock-free ring buffer pop front function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_mpmc_pop_front_with_null_handler);
+    RUN_TEST(check_ring_buffer_mpmc_pop_front_with_null_item);
+    RUN_TEST(check_ring_buffer_mpmc_pop_front_when_empty);
+    RUN_TEST(check_ring_buffer_mpmc_pop_front_data);
+    RUN_TEST(check_ring_buffer_mpmc_pop_front_with_wrap);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_mpmc_layout Run test for lock-free ring buffer handler layout
+     * @{
+     */
+
+#if RING_BUFFER_CACHE_LINE_SIZE > 0
+    RUN_TEST(check_ring_buffer_mpmc_layout_separate_lines);
+#endif // RING_BUFFER_CACHE_LINE_SIZE > 0
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_mpmc_stress Run test for lock-free ring buffer with concurrent threads
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_mpmc_stress_multiple_threads);
+
+    /*! @} */
+
+    UNITY_END();
+}
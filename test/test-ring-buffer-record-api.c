@@ -0,0 +1,363 @@
+/*!
+ * \file test-ring-buffer-record-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the variable-length record ring buffer
+ */
+
+#include "unity.h"
+#include "ring-buffer-record-api.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#define RECORD_CAPACITY (64U)
+
+RingBufferRecordHandler_t record_buf;
+ArenaAllocatorHandler_t arena;
+
+void setUp(void) {
+    arena_allocator_api_init(&arena);
+    ring_buffer_record_api_init(&record_buf, RECORD_CAPACITY, NULL, NULL, &arena);
+}
+
+void tearDown(void) {
+    arena_allocator_api_free(&arena);
+}
+
+/*!
+ * \defgroup ring_buffer_record_init Test record ring buffer initialization
+ * @{
+ */
+
+void check_ring_buffer_record_init_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_init(NULL, RECORD_CAPACITY, NULL, NULL, &arena));
+}
+void check_ring_buffer_record_init_with_null_arena(void) {
+    RingBufferRecordHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_init(&buf, RECORD_CAPACITY, NULL, NULL, NULL));
+}
+void check_ring_buffer_record_init_return_value(void) {
+    RingBufferRecordHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_init(&buf, RECORD_CAPACITY, NULL, NULL, &arena));
+}
+void check_ring_buffer_record_init_capacity_alignment(void) {
+    RingBufferRecordHandler_t buf;
+    ring_buffer_record_api_init(&buf, RECORD_CAPACITY + RING_BUFFER_RECORD_ALIGNMENT - 1U, NULL, NULL, &arena);
+    TEST_ASSERT_EQUAL_size_t(RECORD_CAPACITY, buf.capacity);
+}
+void check_ring_buffer_record_init_empty(void) {
+    TEST_ASSERT_TRUE(ring_buffer_record_api_is_empty(&record_buf));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_record_api_size(&record_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_record_reserve Test record ring buffer reserve and commit functions
+ * @{
+ */
+
+void check_ring_buffer_record_reserve_with_null(void) {
+    void *record;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_reserve(NULL, 8, &record));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_reserve(&record_buf, 8, NULL));
+}
+void check_ring_buffer_record_reserve_too_large(void) {
+    void *record;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_record_api_reserve(&record_buf, RECORD_CAPACITY, &record));
+}
+void check_ring_buffer_record_reserve_length_overflow(void) {
+    void *record = NULL;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_record_api_reserve(&record_buf, SIZE_MAX, &record));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_record_api_reserve(&record_buf, SIZE_MAX - RING_BUFFER_RECORD_ALIGNMENT, &record));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_record_api_reserve(&record_buf, record_buf.capacity - RING_BUFFER_RECORD_HEADER_SIZE + 1U, &record));
+    TEST_ASSERT_NULL(record);
+    TEST_ASSERT_EQUAL_size_t(0U, record_buf.reserved_size);
+}
+void check_ring_buffer_record_reserve_alignment(void) {
+    void *record;
+    ring_buffer_record_api_push(&record_buf, "abc", 3);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_reserve(&record_buf, 8, &record));
+    TEST_ASSERT_EQUAL_size_t(0U, ((uintptr_t)record - (uintptr_t)record_buf.data) % RING_BUFFER_RECORD_ALIGNMENT);
+}
+void check_ring_buffer_record_reserve_not_visible(void) {
+    void *record;
+    ring_buffer_record_api_reserve(&record_buf, 8, &record);
+    TEST_ASSERT_TRUE(ring_buffer_record_api_is_empty(&record_buf));
+}
+void check_ring_buffer_record_commit_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_commit(NULL, 8));
+}
+void check_ring_buffer_record_commit_without_reserve(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_record_api_commit(&record_buf, 8));
+}
+void check_ring_buffer_record_commit_exceeding_reserve(void) {
+    void *record;
+    ring_buffer_record_api_reserve(&record_buf, 8, &record);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_record_api_commit(&record_buf, 16));
+}
+void check_ring_buffer_record_commit_shorter(void) {
+    void *record;
+    ring_buffer_record_api_reserve(&record_buf, 32, &record);
+    memcpy(record, "hello", 5);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_commit(&record_buf, 5));
+    TEST_ASSERT_EQUAL_size_t(RING_BUFFER_RECORD_HEADER_SIZE + 8U, record_buf.write);
+
+    const void *front;
+    size_t length;
+    ring_buffer_record_api_front(&record_buf, &front, &length);
+    TEST_ASSERT_EQUAL_PTR(record, front);
+    TEST_ASSERT_EQUAL_size_t(5U, length);
+    TEST_ASSERT_EQUAL_MEMORY("hello", front, 5);
+}
+void check_ring_buffer_record_reserve_when_full(void) {
+    uint8_t payload[20] = { 0 };
+    ring_buffer_record_api_push(&record_buf, payload, sizeof(payload));
+    ring_buffer_record_api_push(&record_buf, payload, sizeof(payload));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_record_api_push(&record_buf, payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_record_api_size(&record_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_record_front Test record ring buffer front and release functions
+ * @{
+ */
+
+void check_ring_buffer_record_front_with_null(void) {
+    const void *record;
+    size_t length;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_front(NULL, &record, &length));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_front(&record_buf, NULL, &length));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_front(&record_buf, &record, NULL));
+}
+void check_ring_buffer_record_front_when_empty(void) {
+    const void *record;
+    size_t length;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_record_api_front(&record_buf, &record, &length));
+}
+void check_ring_buffer_record_release_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_release(NULL));
+}
+void check_ring_buffer_record_release_when_empty(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_record_api_release(&record_buf));
+}
+void check_ring_buffer_record_release_order(void) {
+    ring_buffer_record_api_push(&record_buf, "first", 5);
+    ring_buffer_record_api_push(&record_buf, "second!", 7);
+
+    const void *record;
+    size_t length;
+    ring_buffer_record_api_front(&record_buf, &record, &length);
+    TEST_ASSERT_EQUAL_size_t(5U, length);
+    TEST_ASSERT_EQUAL_MEMORY("first", record, 5);
+
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_release(&record_buf));
+    ring_buffer_record_api_front(&record_buf, &record, &length);
+    TEST_ASSERT_EQUAL_size_t(7U, length);
+    TEST_ASSERT_EQUAL_MEMORY("second!", record, 7);
+    TEST_ASSERT_EQUAL_size_t(1U, ring_buffer_record_api_size(&record_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_record_wrap Test record ring buffer wrap around
+ * @{
+ */
+
+void check_ring_buffer_record_wrap_contiguous(void) {
+    uint8_t payload[16];
+    for (size_t i = 0; i < sizeof(payload); ++i)
+        payload[i] = (uint8_t)i;
+
+    // Three records fill 60 of the 64 bytes, after releasing the first two
+    // the fourth record does not fit at the end and is placed at the start
+    for (size_t i = 0; i < 3; ++i)
+        ring_buffer_record_api_push(&record_buf, payload, sizeof(payload));
+    ring_buffer_record_api_release(&record_buf);
+    ring_buffer_record_api_release(&record_buf);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_push(&record_buf, payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL_size_t(3U * (RING_BUFFER_RECORD_HEADER_SIZE + sizeof(payload)), record_buf.watermark);
+
+    const void *record;
+    size_t length;
+    ring_buffer_record_api_release(&record_buf);
+    ring_buffer_record_api_front(&record_buf, &record, &length);
+    TEST_ASSERT_EQUAL_PTR((uint8_t *)record_buf.data + RING_BUFFER_RECORD_HEADER_SIZE, record);
+    TEST_ASSERT_EQUAL_size_t(sizeof(payload), length);
+    TEST_ASSERT_EQUAL_MEMORY(payload, record, sizeof(payload));
+}
+void check_ring_buffer_record_wrap_no_overlap(void) {
+    uint8_t payload[20] = { 0 };
+    void *record;
+
+    // The record at the start can not reach the read offset
+    ring_buffer_record_api_push(&record_buf, payload, sizeof(payload));
+    ring_buffer_record_api_push(&record_buf, payload, sizeof(payload));
+    ring_buffer_record_api_release(&record_buf);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_record_api_reserve(&record_buf, sizeof(payload), &record));
+}
+void check_ring_buffer_record_wrap_sequence(void) {
+    uint8_t in[13], out[13];
+    size_t length;
+    for (uint8_t i = 0; i < 100; ++i) {
+        memset(in, i, sizeof(in));
+        size_t size = 1U + i % sizeof(in);
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_push(&record_buf, in, size));
+        if (i % 2U == 1U) {
+            TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_pop(&record_buf, out, sizeof(out), &length));
+            TEST_ASSERT_EQUAL_size_t(1U + (i - 1U) % sizeof(in), length);
+            TEST_ASSERT_EACH_EQUAL_UINT8(i - 1U, out, length);
+            TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_pop(&record_buf, out, sizeof(out), &length));
+            TEST_ASSERT_EQUAL_size_t(size, length);
+            TEST_ASSERT_EACH_EQUAL_UINT8(i, out, length);
+        }
+    }
+    TEST_ASSERT_TRUE(ring_buffer_record_api_is_empty(&record_buf));
+}
+void check_ring_buffer_record_wrap_drained_before_commit(void) {
+    uint8_t in[16] = { 0 }, out[16];
+    const void *front;
+    void *record;
+    size_t length;
+    for (uint8_t i = 0; i < 3; ++i)
+        ring_buffer_record_api_push(&record_buf, in, sizeof(in));
+    ring_buffer_record_api_pop(&record_buf, out, sizeof(out), &length);
+    ring_buffer_record_api_pop(&record_buf, out, sizeof(out), &length);
+
+    // The reservation wraps to the start, then the reader drains up to the old write offset
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_reserve(&record_buf, 8, &record));
+    TEST_ASSERT_EQUAL_PTR(record_buf.data, (uint8_t *)record - RING_BUFFER_RECORD_HEADER_SIZE);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_pop(&record_buf, out, sizeof(out), &length));
+    memset(record, 0xAB, 8);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_commit(&record_buf, 8));
+
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_front(&record_buf, &front, &length));
+    TEST_ASSERT_EQUAL_size_t(8U, length);
+    TEST_ASSERT_EQUAL_PTR(record, front);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_pop(&record_buf, out, sizeof(out), &length));
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xAB, out, 8);
+    TEST_ASSERT_TRUE(ring_buffer_record_api_is_empty(&record_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_record_copy Test record ring buffer push, pop and clear functions
+ * @{
+ */
+
+void check_ring_buffer_record_push_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_push(NULL, "abc", 3));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_push(&record_buf, NULL, 3));
+}
+void check_ring_buffer_record_pop_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_record_api_pop(NULL, NULL, 0, NULL));
+}
+void check_ring_buffer_record_pop_when_empty(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_record_api_pop(&record_buf, NULL, 0, NULL));
+}
+void check_ring_buffer_record_pop_truncated(void) {
+    char out[4] = { 0 };
+    size_t length;
+    ring_buffer_record_api_push(&record_buf, "abcdefgh", 8);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_pop(&record_buf, out, 3, &length));
+    TEST_ASSERT_EQUAL_size_t(8U, length);
+    TEST_ASSERT_EQUAL_STRING("abc", out);
+    TEST_ASSERT_TRUE(ring_buffer_record_api_is_empty(&record_buf));
+}
+void check_ring_buffer_record_push_empty_record(void) {
+    size_t length = 1U;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_push(&record_buf, "", 0));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_pop(&record_buf, NULL, 0, &length));
+    TEST_ASSERT_EQUAL_size_t(0U, length);
+}
+void check_ring_buffer_record_clear(void) {
+    ring_buffer_record_api_push(&record_buf, "abc", 3);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_record_api_clear(&record_buf));
+    TEST_ASSERT_TRUE(ring_buffer_record_api_is_empty(&record_buf));
+    TEST_ASSERT_EQUAL_size_t(0U, record_buf.write);
+}
+
+/*! @} */
+
+int main() {
+    UNITY_BEGIN();
+
+    /*!
+     * \addtogroup ring_buffer_record_init Run test for record ring buffer initialization
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_record_init_with_null);
+    RUN_TEST(check_ring_buffer_record_init_with_null_arena);
+    RUN_TEST(check_ring_buffer_record_init_return_value);
+    RUN_TEST(check_ring_buffer_record_init_capacity_alignment);
+    RUN_TEST(check_ring_buffer_record_init_empty);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_record_reserve Run test for record ring buffer reserve and commit functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_record_reserve_with_null);
+    RUN_TEST(check_ring_buffer_record_reserve_too_large);
+    RUN_TEST(check_ring_buffer_record_reserve_length_overflow);
+    RUN_TEST(check_ring_buffer_record_reserve_alignment);
+    RUN_TEST(check_ring_buffer_record_reserve_not_visible);
+    RUN_TEST(check_ring_buffer_record_commit_with_null);
+    RUN_TEST(check_ring_buffer_record_commit_without_reserve);
+    RUN_TEST(check_ring_buffer_record_commit_exceeding_reserve);
+    RUN_TEST(check_ring_buffer_record_commit_shorter);
+    RUN_TEST(check_ring_buffer_record_reserve_when_full);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_record_front Run test for record ring buffer front and release functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_record_front_with_null);
+    RUN_TEST(check_ring_buffer_record_front_when_empty);
+    RUN_TEST(check_ring_buffer_record_release_with_null);
+    RUN_TEST(check_ring_buffer_record_release_when_empty);
+    RUN_TEST(check_ring_buffer_record_release_order);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_record_wrap Run test for record ring buffer wrap around
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_record_wrap_contiguous);
+    RUN_TEST(check_ring_buffer_record_wrap_no_overlap);
+    RUN_TEST(check_ring_buffer_record_wrap_sequence);
+    RUN_TEST(check_ring_buffer_record_wrap_drained_before_commit);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_record_copy Run test for record ring buffer push, pop and clear functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_record_push_with_null);
+    RUN_TEST(check_ring_buffer_record_pop_with_null);
+    RUN_TEST(check_ring_buffer_record_pop_when_empty);
+    RUN_TEST(check_ring_buffer_record_pop_truncated);
+    RUN_TEST(check_ring_buffer_record_push_empty_record);
+    RUN_TEST(check_ring_buffer_record_clear);
+
+    /*! @} */
+
+    UNITY_END();
+}
@@ -0,0 +1,299 @@
+/*!
+ * \file test-ring-buffer-shm-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the ring buffer placed in a named shared memory segment
+ *
+ * \details Other than the tests of each function done with two handlers in
+ *      the same process, a test forks a producer process and checks that
+ *      every item is received in order.
+ */
+
+#include "unity.h"
+#include "ring-buffer-shm-api.h"
+
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define SHM_NAME_SIZE (32U)
+#define FORK_ITEMS (100000U)
+
+typedef struct {
+    float x, y;
+} Point;
+
+char shm_name[SHM_NAME_SIZE];
+RingBufferShmHandler_t producer_buf;
+RingBufferShmHandler_t consumer_buf;
+
+void setUp(void) {
+    snprintf(shm_name, sizeof(shm_name), "/ring-buffer-test-%d", (int)getpid());
+    ring_buffer_shm_api_create(&producer_buf, shm_name, sizeof(Point), 10);
+    ring_buffer_shm_api_attach(&consumer_buf, shm_name);
+}
+
+void tearDown(void) {
+    ring_buffer_shm_api_detach(&producer_buf);
+    ring_buffer_shm_api_detach(&consumer_buf);
+    ring_buffer_shm_api_unlink(shm_name);
+}
+
+/*!
+ * \defgroup ring_buffer_shm_create Test shared ring buffer creation
+ * @{
+ */
+
+void check_ring_buffer_shm_create_with_null(void) {
+    RingBufferShmHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_create(NULL, "/ring-buffer-null", sizeof(Point), 10));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_create(&buf, NULL, sizeof(Point), 10));
+}
+void check_ring_buffer_shm_create_when_existing(void) {
+    RingBufferShmHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_create(&buf, shm_name, sizeof(Point), 10));
+}
+void check_ring_buffer_shm_create_with_invalid_size(void) {
+    RingBufferShmHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_shm_api_create(&buf, "/ring-buffer-invalid", 0, 10));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_shm_api_create(&buf, "/ring-buffer-invalid", sizeof(Point), 0));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_shm_api_create(&buf, "/ring-buffer-invalid", sizeof(Point), SIZE_MAX));
+}
+void check_ring_buffer_shm_create_header(void) {
+    const RingBufferShmHeader_t *header = producer_buf.header;
+    TEST_ASSERT_NOT_NULL(header);
+    TEST_ASSERT_EQUAL_UINT32(RING_BUFFER_SHM_MAGIC, atomic_load(&header->magic));
+    TEST_ASSERT_EQUAL_UINT32(RING_BUFFER_SHM_VERSION, header->version);
+    TEST_ASSERT_EQUAL_UINT64(sizeof(Point), header->data_size);
+    TEST_ASSERT_EQUAL_UINT64(11U, header->slots);
+    TEST_ASSERT_TRUE(ring_buffer_shm_api_is_empty(&producer_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_shm_attach Test shared ring buffer attach and detach
+ * @{
+ */
+
+void check_ring_buffer_shm_attach_with_null(void) {
+    RingBufferShmHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(NULL, shm_name));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(&buf, NULL));
+}
+void check_ring_buffer_shm_attach_when_missing(void) {
+    RingBufferShmHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(&buf, "/ring-buffer-missing"));
+}
+void check_ring_buffer_shm_attach_with_wrong_version(void) {
+    RingBufferShmHandler_t buf;
+    producer_buf.header->version = RING_BUFFER_SHM_VERSION + 1U;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(&buf, shm_name));
+}
+void check_ring_buffer_shm_attach_with_zero_slots(void) {
+    RingBufferShmHandler_t buf;
+    producer_buf.header->slots = 0U;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(&buf, shm_name));
+    producer_buf.header->slots = 1U;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(&buf, shm_name));
+}
+void check_ring_buffer_shm_attach_with_zero_data_size(void) {
+    RingBufferShmHandler_t buf;
+    producer_buf.header->data_size = 0U;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(&buf, shm_name));
+}
+void check_ring_buffer_shm_attach_larger_than_segment(void) {
+    RingBufferShmHandler_t buf;
+    producer_buf.header->slots = 12U;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(&buf, shm_name));
+    producer_buf.header->slots = UINT64_MAX / sizeof(Point) + 2U;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(&buf, shm_name));
+    producer_buf.header->slots = 11U;
+    producer_buf.header->data_offset = UINT64_MAX;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_attach(&buf, shm_name));
+}
+void check_ring_buffer_shm_attach_ignores_later_changes(void) {
+    Point in = { 1.0f, 2.0f }, out;
+    producer_buf.header->slots = 0U;
+    producer_buf.header->data_size = 0U;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_shm_api_push_back(&producer_buf, &in));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_shm_api_pop_front(&consumer_buf, &out));
+    TEST_ASSERT_EQUAL_MEMORY(&in, &out, sizeof(Point));
+}
+void check_ring_buffer_shm_attach_same_data(void) {
+    TEST_ASSERT_NOT_NULL(consumer_buf.header);
+    TEST_ASSERT_EQUAL_size_t(producer_buf.map_size, consumer_buf.map_size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(producer_buf.header, consumer_buf.header, sizeof(RingBufferShmHeader_t)));
+}
+void check_ring_buffer_shm_detach_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_detach(NULL));
+}
+void check_ring_buffer_shm_detach_twice(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_shm_api_detach(&consumer_buf));
+    TEST_ASSERT_NULL(consumer_buf.header);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_detach(&consumer_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_shm_push_pop Test shared ring buffer push and pop functions
+ * @{
+ */
+
+void check_ring_buffer_shm_push_back_with_null(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_push_back(NULL, &p));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_push_back(&producer_buf, NULL));
+}
+void check_ring_buffer_shm_push_back_when_full(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    for (size_t i = 0; i < 10; ++i)
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_shm_api_push_back(&producer_buf, &p));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_shm_api_push_back(&producer_buf, &p));
+    TEST_ASSERT_EQUAL_size_t(10U, ring_buffer_shm_api_size(&consumer_buf));
+}
+void check_ring_buffer_shm_pop_front_with_null(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_shm_api_pop_front(NULL, &p));
+}
+void check_ring_buffer_shm_pop_front_when_empty(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_shm_api_pop_front(&consumer_buf, &p));
+}
+void check_ring_buffer_shm_pop_front_data(void) {
+    Point dot = { .x = 69.69f, .y = 2.7f };
+    Point p = { 0 };
+    ring_buffer_shm_api_push_back(&producer_buf, &dot);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_shm_api_pop_front(&consumer_buf, &p));
+    TEST_ASSERT_EQUAL_MEMORY(&dot, &p, sizeof(Point));
+    TEST_ASSERT_TRUE(ring_buffer_shm_api_is_empty(&producer_buf));
+}
+void check_ring_buffer_shm_push_pop_n_with_wrap(void) {
+    Point items[6], out[6];
+    for (size_t i = 0; i < 6; ++i)
+        items[i] = (Point){ .x = (float)i, .y = -(float)i };
+    atomic_store(&producer_buf.header->head, 8U);
+    atomic_store(&producer_buf.header->tail, 8U);
+
+    TEST_ASSERT_EQUAL_size_t(6U, ring_buffer_shm_api_push_back_n(&producer_buf, items, 6));
+    TEST_ASSERT_EQUAL_UINT64(3U, atomic_load(&producer_buf.header->tail));
+    TEST_ASSERT_EQUAL_size_t(6U, ring_buffer_shm_api_pop_front_n(&consumer_buf, out, 10));
+    TEST_ASSERT_EQUAL_MEMORY(items, out, sizeof(items));
+}
+void check_ring_buffer_shm_push_back_n_partial(void) {
+    Point items[12] = { 0 };
+    TEST_ASSERT_EQUAL_size_t(10U, ring_buffer_shm_api_push_back_n(&producer_buf, items, 12));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_shm_fork Test shared ring buffer between two processes
+ * @{
+ */
+
+void check_ring_buffer_shm_two_processes(void) {
+    RingBufferShmHandler_t u32_buf;
+    char name[SHM_NAME_SIZE];
+    snprintf(name, sizeof(name), "/ring-buffer-fork-%d", (int)getpid());
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_shm_api_create(&u32_buf, name, sizeof(uint32_t), 64));
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        RingBufferShmHandler_t child_buf;
+        if (ring_buffer_shm_api_attach(&child_buf, name) != RING_BUFFER_OK)
+            _exit(1);
+        for (uint32_t i = 0; i < FORK_ITEMS; ++i) {
+            while (ring_buffer_shm_api_push_back(&child_buf, &i) != RING_BUFFER_OK)
+                sched_yield();
+        }
+        _exit(0);
+    }
+
+    uint32_t errors = 0;
+    for (uint32_t expected = 0; expected < FORK_ITEMS;) {
+        uint32_t val;
+        if (ring_buffer_shm_api_pop_front(&u32_buf, &val) != RING_BUFFER_OK) {
+            sched_yield();
+            continue;
+        }
+        if (val != expected)
+            ++errors;
+        ++expected;
+    }
+    int status = -1;
+    waitpid(pid, &status, 0);
+    ring_buffer_shm_api_detach(&u32_buf);
+    ring_buffer_shm_api_unlink(name);
+
+    TEST_ASSERT_EQUAL_INT(0, status);
+    TEST_ASSERT_EQUAL_UINT32(0U, errors);
+}
+
+/*! @} */
+
+int main() {
+    UNITY_BEGIN();
+
+    /*!
+     * \addtogroup ring_buffer_shm_create Run test for shared ring buffer creation
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_shm_create_with_null);
+    RUN_TEST(check_ring_buffer_shm_create_when_existing);
+    RUN_TEST(check_ring_buffer_shm_create_with_invalid_size);
+    RUN_TEST(check_ring_buffer_shm_create_header);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_shm_attach Run test for shared ring buffer attach and detach
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_shm_attach_with_null);
+    RUN_TEST(check_ring_buffer_shm_attach_when_missing);
+    RUN_TEST(check_ring_buffer_shm_attach_with_wrong_version);
+    RUN_TEST(check_ring_buffer_shm_attach_with_zero_slots);
+    RUN_TEST(check_ring_buffer_shm_attach_with_zero_data_size);
+    RUN_TEST(check_ring_buffer_shm_attach_larger_than_segment);
+    RUN_TEST(check_ring_buffer_shm_attach_ignores_later_changes);
+    RUN_TEST(check_ring_buffer_shm_attach_same_data);
+    RUN_TEST(check_ring_buffer_shm_detach_with_null);
+    RUN_TEST(check_ring_buffer_shm_detach_twice);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_shm_push_pop Run test for shared ring buffer push and pop functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_shm_push_back_with_null);
+    RUN_TEST(check_ring_buffer_shm_push_back_when_full);
+    RUN_TEST(check_ring_buffer_shm_pop_front_with_null);
+    RUN_TEST(check_ring_buffer_shm_pop_front_when_empty);
+    RUN_TEST(check_ring_buffer_shm_pop_front_data);
+    RUN_TEST(check_ring_buffer_shm_push_pop_n_with_wrap);
+    RUN_TEST(check_ring_buffer_shm_push_back_n_partial);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_shm_fork Run test for shared ring buffer between two processes
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_shm_two_processes);
+
+    /*! @} */
+
+    UNITY_END();
+}
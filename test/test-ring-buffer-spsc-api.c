@@ -0,0 +1,487 @@
+/*!
+ * \file test-ring-buffer-spsc-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the lock-free single-producer/single-consumer ring buffer
+ *
+ * \details Other than the single thread tests of each function, a stress test
+ *      runs a producer and a consumer thread concurrently and checks that
+ *      every item is received exactly once and in order.
+ */
+
+#include "unity.h"
+#include "ring-buffer-spsc-api.h"
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define STRESS_ITEMS (100000U)
+
+typedef struct {
+    float x, y;
+} Point;
+
+RingBufferSpscHandler_t point_buf;
+RingBufferSpscHandler_t u32_buf;
+ArenaAllocatorHandler_t arena;
+
+void setUp(void) {
+    arena_allocator_api_init(&arena);
+    ring_buffer_spsc_api_init(&point_buf, sizeof(Point), 10, &arena);
+    ring_buffer_spsc_api_init(&u32_buf, sizeof(uint32_t), 64, &arena);
+}
+
+void tearDown(void) {
+    arena_allocator_api_free(&arena);
+}
+
+// Move both indices of an empty buffer, the cached copies are updated as well
+static void set_indices(RingBufferSpscHandler_t *buffer, size_t index) {
+    atomic_store(&buffer->head, index);
+    atomic_store(&buffer->tail, index);
+    buffer->head_cache = index;
+    buffer->tail_cache = index;
+}
+
+/*!
+ * \defgroup ring_buffer_spsc_init Test lock-free ring buffer initialization
+ * @{
+ */
+
+void check_ring_buffer_spsc_init_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_spsc_api_init(NULL, sizeof(float), 3, &arena));
+}
+void check_ring_buffer_spsc_init_with_null_arena(void) {
+    RingBufferSpscHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_spsc_api_init(&buf, sizeof(float), 3, NULL));
+}
+void check_ring_buffer_spsc_init_return_value(void) {
+    RingBufferSpscHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_spsc_api_init(&buf, sizeof(float), 3, &arena));
+}
+void check_ring_buffer_spsc_init_invalid_data_size(void) {
+    RingBufferSpscHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_spsc_api_init(&buf, 0U, 3, &arena));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_spsc_api_init(&buf, RING_BUFFER_MAX_DATA_SIZE + 1U, 3, &arena));
+}
+void check_ring_buffer_spsc_init_zero_capacity(void) {
+    RingBufferSpscHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_spsc_api_init(&buf, sizeof(float), 0, &arena));
+}
+void check_ring_buffer_spsc_init_capacity_too_large(void) {
+    RingBufferSpscHandler_t buf;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_spsc_api_init(&buf, sizeof(float), SIZE_MAX, &arena));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_INVALID_ARGUMENT, ring_buffer_spsc_api_init(&buf, sizeof(float), SIZE_MAX / sizeof(float), &arena));
+}
+void check_ring_buffer_spsc_init_empty(void) {
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_empty(&point_buf));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_spsc_api_size(&point_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_spsc_state Test lock-free ring buffer state functions
+ * @{
+ */
+
+void check_ring_buffer_spsc_empty_with_null(void) {
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_empty(NULL));
+}
+void check_ring_buffer_spsc_full_with_null(void) {
+    TEST_ASSERT_FALSE(ring_buffer_spsc_api_is_full(NULL));
+}
+void check_ring_buffer_spsc_size_with_null(void) {
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_spsc_api_size(NULL));
+}
+void check_ring_buffer_spsc_full_when_full(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    for (size_t i = 0; i < 10; ++i)
+        ring_buffer_spsc_api_push_back(&point_buf, &p);
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_full(&point_buf));
+    TEST_ASSERT_EQUAL_size_t(10U, ring_buffer_spsc_api_size(&point_buf));
+}
+void check_ring_buffer_spsc_size_with_wrap(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    set_indices(&point_buf, point_buf.slots - 2);
+    for (size_t i = 0; i < 5; ++i)
+        ring_buffer_spsc_api_push_back(&point_buf, &p);
+    TEST_ASSERT_EQUAL_size_t(5U, ring_buffer_spsc_api_size(&point_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_spsc_push_back Test lock-free ring buffer push back function
+ * @{
+ */
+
+void check_ring_buffer_spsc_push_back_with_null_handler(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_spsc_api_push_back(NULL, &p));
+}
+void check_ring_buffer_spsc_push_back_with_null_item(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_spsc_api_push_back(&point_buf, NULL));
+}
+void check_ring_buffer_spsc_push_back_when_full(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    for (size_t i = 0; i < 10; ++i)
+        ring_buffer_spsc_api_push_back(&point_buf, &p);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_spsc_api_push_back(&point_buf, &p));
+}
+void check_ring_buffer_spsc_push_back_data(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_spsc_api_push_back(&point_buf, &p));
+    TEST_ASSERT_EQUAL_MEMORY(&p, &((Point *)point_buf.data)[0], sizeof(Point));
+    TEST_ASSERT_EQUAL_size_t(1U, atomic_load(&point_buf.tail));
+}
+void check_ring_buffer_spsc_push_back_with_wrap_index(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    set_indices(&point_buf, point_buf.slots - 1);
+    ring_buffer_spsc_api_push_back(&point_buf, &p);
+    TEST_ASSERT_EQUAL_size_t(0U, atomic_load(&point_buf.tail));
+    TEST_ASSERT_EQUAL_MEMORY(&p, &((Point *)point_buf.data)[point_buf.slots - 1], sizeof(Point));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_spsc_pop_front Test lock-free ring buffer pop front function
+ * @{
+ */
+
+void check_ring_buffer_spsc_pop_front_with_null_handler(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_spsc_api_pop_front(NULL, &p));
+}
+void check_ring_buffer_spsc_pop_front_with_null_item(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    ring_buffer_spsc_api_push_back(&point_buf, &p);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_spsc_api_pop_front(&point_buf, NULL));
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_empty(&point_buf));
+}
+void check_ring_buffer_spsc_pop_front_when_empty(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_spsc_api_pop_front(&point_buf, &p));
+}
+void check_ring_buffer_spsc_pop_front_data(void) {
+    Point dot = { .x = 69.69f, .y = 2.7f };
+    Point p = { 0 };
+    ring_buffer_spsc_api_push_back(&point_buf, &dot);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_spsc_api_pop_front(&point_buf, &p));
+    TEST_ASSERT_EQUAL_MEMORY(&dot, &p, sizeof(Point));
+}
+void check_ring_buffer_spsc_pop_front_with_wrap_index(void) {
+    Point dot = { .x = 69.69f, .y = 2.7f };
+    Point p = { 0 };
+    set_indices(&point_buf, point_buf.slots - 1);
+    ring_buffer_spsc_api_push_back(&point_buf, &dot);
+    ring_buffer_spsc_api_pop_front(&point_buf, &p);
+    TEST_ASSERT_EQUAL_size_t(0U, atomic_load(&point_buf.head));
+    TEST_ASSERT_EQUAL_MEMORY(&dot, &p, sizeof(Point));
+}
+void check_ring_buffer_spsc_pop_front_order(void) {
+    for (uint32_t i = 0; i < 100; ++i) {
+        ring_buffer_spsc_api_push_back(&u32_buf, &i);
+        uint32_t val = UINT32_MAX;
+        ring_buffer_spsc_api_pop_front(&u32_buf, &val);
+        TEST_ASSERT_EQUAL_UINT32(i, val);
+    }
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_spsc_stress Test lock-free ring buffer with concurrent threads
+ * @{
+ */
+
+static void *stress_producer(void *arg) {
+    RingBufferSpscHandler_t *buffer = (RingBufferSpscHandler_t *)arg;
+    for (uint32_t i = 0; i < STRESS_ITEMS; ++i) {
+        while (ring_buffer_spsc_api_push_back(buffer, &i) != RING_BUFFER_OK)
+            ;
+    }
+    return NULL;
+}
+
+void check_ring_buffer_spsc_stress_two_threads(void) {
+    pthread_t producer;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&producer, NULL, stress_producer, &u32_buf));
+
+    uint32_t expected = 0;
+    uint32_t errors = 0;
+    while (expected < STRESS_ITEMS) {
+        uint32_t val;
+        if (ring_buffer_spsc_api_pop_front(&u32_buf, &val) != RING_BUFFER_OK)
+            continue;
+        if (val != expected)
+            ++errors;
+        ++expected;
+    }
+    pthread_join(producer, NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(0U, errors);
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_empty(&u32_buf));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_spsc_layout Test lock-free ring buffer handler layout
+ * @{
+ */
+
+#if RING_BUFFER_CACHE_LINE_SIZE > 0
+void check_ring_buffer_spsc_layout_separate_lines(void) {
+    const size_t line = RING_BUFFER_CACHE_LINE_SIZE;
+    TEST_ASSERT_NOT_EQUAL(offsetof(RingBufferSpscHandler_t, slots) / line, offsetof(RingBufferSpscHandler_t, tail) / line);
+    TEST_ASSERT_NOT_EQUAL(offsetof(RingBufferSpscHandler_t, tail) / line, offsetof(RingBufferSpscHandler_t, head) / line);
+    TEST_ASSERT_EQUAL_size_t(offsetof(RingBufferSpscHandler_t, tail) / line, offsetof(RingBufferSpscHandler_t, head_cache) / line);
+    TEST_ASSERT_EQUAL_size_t(offsetof(RingBufferSpscHandler_t, head) / line, offsetof(RingBufferSpscHandler_t, tail_cache) / line);
+}
+#endif // RING_BUFFER_CACHE_LINE_SIZE > 0
+void check_ring_buffer_spsc_cached_index_refresh(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    for (size_t i = 0; i < 10; ++i)
+        ring_buffer_spsc_api_push_back(&point_buf, &p);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_spsc_api_push_back(&point_buf, &p));
+
+    // The producer sees the freed slot only after reloading the head
+    ring_buffer_spsc_api_pop_front(&point_buf, NULL);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_spsc_api_push_back(&point_buf, &p));
+    TEST_ASSERT_EQUAL_size_t(1U, point_buf.head_cache);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_spsc_batch Test lock-free ring buffer batch functions
+ * @{
+ */
+
+void check_ring_buffer_spsc_push_back_n_with_null(void) {
+    uint32_t items[4] = { 0 };
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_spsc_api_push_back_n(NULL, items, 4));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_spsc_api_push_back_n(&u32_buf, NULL, 4));
+}
+void check_ring_buffer_spsc_push_back_n_when_almost_full(void) {
+    uint32_t items[80] = { 0 };
+    TEST_ASSERT_EQUAL_size_t(60U, ring_buffer_spsc_api_push_back_n(&u32_buf, items, 60));
+    TEST_ASSERT_EQUAL_size_t(4U, ring_buffer_spsc_api_push_back_n(&u32_buf, items, 20));
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_full(&u32_buf));
+}
+void check_ring_buffer_spsc_pop_front_n_with_null(void) {
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_spsc_api_pop_front_n(NULL, NULL, 4));
+}
+void check_ring_buffer_spsc_batch_with_wrap_index(void) {
+    uint32_t items[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    uint32_t out[8] = { 0 };
+    set_indices(&u32_buf, u32_buf.slots - 3);
+    TEST_ASSERT_EQUAL_size_t(8U, ring_buffer_spsc_api_push_back_n(&u32_buf, items, 8));
+    TEST_ASSERT_EQUAL_size_t(5U, atomic_load(&u32_buf.tail));
+    TEST_ASSERT_EQUAL_size_t(8U, ring_buffer_spsc_api_pop_front_n(&u32_buf, out, 10));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(items, out, sizeof(items));
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_empty(&u32_buf));
+}
+void check_ring_buffer_spsc_stage_back_with_null(void) {
+    uint32_t val = 0;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_spsc_api_stage_back(NULL, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_spsc_api_stage_back(&u32_buf, NULL));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_spsc_api_publish(NULL));
+}
+void check_ring_buffer_spsc_stage_back_not_visible(void) {
+    uint32_t val = 42;
+    ring_buffer_spsc_api_stage_back(&u32_buf, &val);
+    ring_buffer_spsc_api_stage_back(&u32_buf, &val);
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_empty(&u32_buf));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_spsc_api_pop_front(&u32_buf, &val));
+
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_spsc_api_publish(&u32_buf));
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_spsc_api_size(&u32_buf));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_spsc_api_publish(&u32_buf));
+}
+void check_ring_buffer_spsc_stage_back_when_full(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    for (size_t i = 0; i < 10; ++i)
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_spsc_api_stage_back(&point_buf, &p));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_spsc_api_stage_back(&point_buf, &p));
+    TEST_ASSERT_EQUAL_size_t(10U, ring_buffer_spsc_api_publish(&point_buf));
+}
+void check_ring_buffer_spsc_push_back_publishes_staged(void) {
+    uint32_t val = 1;
+    ring_buffer_spsc_api_stage_back(&u32_buf, &val);
+    val = 2;
+    ring_buffer_spsc_api_push_back(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_size_t(2U, ring_buffer_spsc_api_size(&u32_buf));
+    ring_buffer_spsc_api_pop_front(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_UINT32(1U, val);
+}
+void check_ring_buffer_spsc_read_front_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_spsc_api_read_front(NULL, NULL));
+    TEST_ASSERT_EQUAL_size_t(0U, ring_buffer_spsc_api_acknowledge(NULL));
+}
+void check_ring_buffer_spsc_read_front_order(void) {
+    uint32_t items[3] = { 7, 8, 9 };
+    uint32_t val;
+    ring_buffer_spsc_api_push_back_n(&u32_buf, items, 3);
+    for (size_t i = 0; i < 3; ++i) {
+        TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_spsc_api_read_front(&u32_buf, &val));
+        TEST_ASSERT_EQUAL_UINT32(items[i], val);
+    }
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_spsc_api_read_front(&u32_buf, &val));
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_spsc_api_size(&u32_buf));
+
+    TEST_ASSERT_EQUAL_size_t(3U, ring_buffer_spsc_api_acknowledge(&u32_buf));
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_empty(&u32_buf));
+}
+void check_ring_buffer_spsc_read_front_slots_not_released(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    for (size_t i = 0; i < 10; ++i)
+        ring_buffer_spsc_api_push_back(&point_buf, &p);
+    ring_buffer_spsc_api_read_front(&point_buf, NULL);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_spsc_api_push_back(&point_buf, &p));
+    ring_buffer_spsc_api_acknowledge(&point_buf);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_spsc_api_push_back(&point_buf, &p));
+}
+
+static void *stress_batch_producer(void *arg) {
+    RingBufferSpscHandler_t *buffer = (RingBufferSpscHandler_t *)arg;
+    for (uint32_t i = 0; i < STRESS_ITEMS; ++i) {
+        while (ring_buffer_spsc_api_stage_back(buffer, &i) != RING_BUFFER_OK)
+            ring_buffer_spsc_api_publish(buffer);
+        if (i % 16U == 15U)
+            ring_buffer_spsc_api_publish(buffer);
+    }
+    ring_buffer_spsc_api_publish(buffer);
+    return NULL;
+}
+void check_ring_buffer_spsc_stress_batch(void) {
+    pthread_t producer;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&producer, NULL, stress_batch_producer, &u32_buf));
+
+    uint32_t expected = 0;
+    uint32_t errors = 0;
+    while (expected < STRESS_ITEMS) {
+        uint32_t val;
+        if (ring_buffer_spsc_api_read_front(&u32_buf, &val) != RING_BUFFER_OK) {
+            ring_buffer_spsc_api_acknowledge(&u32_buf);
+            continue;
+        }
+        if (val != expected)
+            ++errors;
+        ++expected;
+    }
+    ring_buffer_spsc_api_acknowledge(&u32_buf);
+    pthread_join(producer, NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(0U, errors);
+    TEST_ASSERT_TRUE(ring_buffer_spsc_api_is_empty(&u32_buf));
+}
+
+/*! @} */
+
+int main() {
+    UNITY_BEGIN();
+
+    /*!
+     * \addtogroup ring_buffer_spsc_init Run test for lock-free ring buffer initialization
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_spsc_init_with_null);
+    RUN_TEST(check_ring_buffer_spsc_init_with_null_arena);
+    RUN_TEST(check_ring_buffer_spsc_init_return_value);
+    RUN_TEST(check_ring_buffer_spsc_init_invalid_data_size);
+    RUN_TEST(check_ring_buffer_spsc_init_zero_capacity);
+    RUN_TEST(check_ring_buffer_spsc_init_capacity_too_large);
+    RUN_TEST(check_ring_buffer_spsc_init_empty);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_spsc_state Run test for lock-free ring buffer state functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_spsc_empty_with_null);
+    RUN_TEST(check_ring_buffer_spsc_full_with_null);
+    RUN_TEST(check_ring_buffer_spsc_size_with_null);
+    RUN_TEST(check_ring_buffer_spsc_full_when_full);
+    RUN_TEST(check_ring_buffer_spsc_size_with_wrap);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_spsc_push_back Run test for lock-free ring buffer push back function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_spsc_push_back_with_null_handler);
+    RUN_TEST(check_ring_buffer_spsc_push_back_with_null_item);
+    RUN_TEST(check_ring_buffer_spsc_push_back_when_full);
+    RUN_TEST(check_ring_buffer_spsc_push_back_data);
+    RUN_TEST(check_ring_buffer_spsc_push_back_with_wrap_index);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_spsc_pop_front Run test for lock-free ring buffer pop front function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_spsc_pop_front_with_null_handler);
+    RUN_TEST(check_ring_buffer_spsc_pop_front_with_null_item);
+    RUN_TEST(check_ring_buffer_spsc_pop_front_when_empty);
+    RUN_TEST(check_ring_buffer_spsc_pop_front_data);
+    RUN_TEST(check_ring_buffer_spsc_pop_front_with_wrap_index);
+    RUN_TEST(check_ring_buffer_spsc_pop_front_order);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_spsc_stress Run test for lock-free ring buffer with concurrent threads
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_spsc_stress_two_threads);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_spsc_layout Run test for lock-free ring buffer handler layout
+     * @{
+     */
+
+#if RING_BUFFER_CACHE_LINE_SIZE > 0
+    RUN_TEST(check_ring_buffer_spsc_layout_separate_lines);
+#endif // RING_BUFFER_CACHE_LINE_SIZE > 0
+    RUN_TEST(check_ring_buffer_spsc_cached_index_refresh);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_spsc_batch Run test for lock-free ring buffer batch functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_spsc_push_back_n_with_null);
+    RUN_TEST(check_ring_buffer_spsc_push_back_n_when_almost_full);
+    RUN_TEST(check_ring_buffer_spsc_pop_front_n_with_null);
+    RUN_TEST(check_ring_buffer_spsc_batch_with_wrap_index);
+    RUN_TEST(check_ring_buffer_spsc_stage_back_with_null);
+    RUN_TEST(check_ring_buffer_spsc_stage_back_not_visible);
+    RUN_TEST(check_ring_buffer_spsc_stage_back_when_full);
+    RUN_TEST(check_ring_buffer_spsc_push_back_publishes_staged);
+    RUN_TEST(check_ring_buffer_spsc_read_front_with_null);
+    RUN_TEST(check_ring_buffer_spsc_read_front_order);
+    RUN_TEST(check_ring_buffer_spsc_read_front_slots_not_released);
+    RUN_TEST(check_ring_buffer_spsc_stress_batch);
+
+    /*! @} */
+
+    UNITY_END();
+}
@@ -0,0 +1,239 @@
+/*!
+ * \file test-ring-buffer-typed.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the statically allocated ring buffers generated by the
+ *      RING_BUFFER_DEFINE macro
+ */
+
+#include "unity.h"
+#include "ring-buffer-typed.h"
+
+#include <string.h>
+
+typedef struct {
+    float x, y;
+} Point;
+
+RING_BUFFER_DEFINE(point_ring, Point, 10)
+RING_BUFFER_DEFINE(int_ring, int, 4)
+
+static point_ring_t point_buf;
+static int_ring_t int_buf;
+
+void setUp(void) {
+    memset(&point_buf, 0, sizeof(point_buf));
+    memset(&int_buf, 0, sizeof(int_buf));
+}
+
+void tearDown(void) {
+}
+
+/*!
+ * \defgroup ring_buffer_typed_state Test typed ring buffer state functions
+ * @{
+ */
+
+void check_ring_buffer_typed_zero_initialized_is_empty(void) {
+    static point_ring_t buf;
+    TEST_ASSERT_TRUE(point_ring_is_empty(&buf));
+    TEST_ASSERT_EQUAL_size_t(0U, point_ring_size(&buf));
+}
+void check_ring_buffer_typed_empty_with_null(void) {
+    TEST_ASSERT_TRUE(point_ring_is_empty(NULL));
+}
+void check_ring_buffer_typed_full_with_null(void) {
+    TEST_ASSERT_FALSE(point_ring_is_full(NULL));
+}
+void check_ring_buffer_typed_full_when_full(void) {
+    int_buf.size = 4;
+    TEST_ASSERT_TRUE(int_ring_is_full(&int_buf));
+}
+void check_ring_buffer_typed_size_with_null(void) {
+    TEST_ASSERT_EQUAL_size_t(0U, point_ring_size(NULL));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_typed_push Test typed ring buffer push functions
+ * @{
+ */
+
+void check_ring_buffer_typed_push_back_with_null(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, point_ring_push_back(NULL, &p));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, point_ring_push_back(&point_buf, NULL));
+}
+void check_ring_buffer_typed_push_back_when_full(void) {
+    int val = 1;
+    int_buf.size = 4;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, int_ring_push_back(&int_buf, &val));
+}
+void check_ring_buffer_typed_push_back_with_wrap_data(void) {
+    int val = 42;
+    int_buf.start = 3;
+    int_buf.size = 1;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, int_ring_push_back(&int_buf, &val));
+    TEST_ASSERT_EQUAL_INT(42, int_buf.items[0]);
+    TEST_ASSERT_EQUAL_size_t(2U, int_buf.size);
+}
+void check_ring_buffer_typed_push_front_with_null(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, point_ring_push_front(NULL, &p));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, point_ring_push_front(&point_buf, NULL));
+}
+void check_ring_buffer_typed_push_front_when_full(void) {
+    int val = 1;
+    int_buf.size = 4;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, int_ring_push_front(&int_buf, &val));
+}
+void check_ring_buffer_typed_push_front_with_wrap_data(void) {
+    Point p = { .x = 69.69f, .y = 2.7f };
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, point_ring_push_front(&point_buf, &p));
+    TEST_ASSERT_EQUAL_size_t(9U, point_buf.start);
+    TEST_ASSERT_EQUAL_MEMORY(&p, &point_buf.items[9], sizeof(Point));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_typed_pop Test typed ring buffer pop functions
+ * @{
+ */
+
+void check_ring_buffer_typed_pop_front_with_null(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, point_ring_pop_front(NULL, &p));
+}
+void check_ring_buffer_typed_pop_front_when_empty(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, point_ring_pop_front(&point_buf, &p));
+}
+void check_ring_buffer_typed_pop_front_with_wrap_data(void) {
+    int val = 0;
+    int_buf.start = 3;
+    int_buf.size = 2;
+    int_buf.items[3] = 1;
+    int_buf.items[0] = 2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, int_ring_pop_front(&int_buf, &val));
+    TEST_ASSERT_EQUAL_INT(1, val);
+    TEST_ASSERT_EQUAL_size_t(0U, int_buf.start);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, int_ring_pop_front(&int_buf, NULL));
+    TEST_ASSERT_TRUE(int_ring_is_empty(&int_buf));
+}
+void check_ring_buffer_typed_pop_back_with_null(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, point_ring_pop_back(NULL, &p));
+}
+void check_ring_buffer_typed_pop_back_when_empty(void) {
+    Point p;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, point_ring_pop_back(&point_buf, &p));
+}
+void check_ring_buffer_typed_pop_back_with_wrap_data(void) {
+    int val = 0;
+    int_buf.start = 3;
+    int_buf.size = 2;
+    int_buf.items[3] = 1;
+    int_buf.items[0] = 2;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, int_ring_pop_back(&int_buf, &val));
+    TEST_ASSERT_EQUAL_INT(2, val);
+    TEST_ASSERT_EQUAL_size_t(1U, int_buf.size);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_typed_access Test typed ring buffer access functions
+ * @{
+ */
+
+void check_ring_buffer_typed_front_and_back(void) {
+    int val = 0;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, int_ring_front(&int_buf, &val));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, int_ring_back(&int_buf, &val));
+    for (int i = 1; i <= 3; ++i)
+        int_ring_push_back(&int_buf, &i);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, int_ring_front(&int_buf, &val));
+    TEST_ASSERT_EQUAL_INT(1, val);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, int_ring_back(&int_buf, &val));
+    TEST_ASSERT_EQUAL_INT(3, val);
+}
+void check_ring_buffer_typed_peek(void) {
+    TEST_ASSERT_NULL(int_ring_peek_front(&int_buf));
+    TEST_ASSERT_NULL(int_ring_peek_back(&int_buf));
+    for (int i = 1; i <= 3; ++i)
+        int_ring_push_front(&int_buf, &i);
+    TEST_ASSERT_EQUAL_INT(3, *int_ring_peek_front(&int_buf));
+    TEST_ASSERT_EQUAL_INT(1, *int_ring_peek_back(&int_buf));
+}
+void check_ring_buffer_typed_clear(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, int_ring_clear(NULL));
+    int_buf.start = 2;
+    int_buf.size = 3;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, int_ring_clear(&int_buf));
+    TEST_ASSERT_EQUAL_size_t(0U, int_buf.start);
+    TEST_ASSERT_EQUAL_size_t(0U, int_buf.size);
+}
+
+/*! @} */
+
+int main() {
+    UNITY_BEGIN();
+
+    /*!
+     * \addtogroup ring_buffer_typed_state Run test for typed ring buffer state functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_typed_zero_initialized_is_empty);
+    RUN_TEST(check_ring_buffer_typed_empty_with_null);
+    RUN_TEST(check_ring_buffer_typed_full_with_null);
+    RUN_TEST(check_ring_buffer_typed_full_when_full);
+    RUN_TEST(check_ring_buffer_typed_size_with_null);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_typed_push Run test for typed ring buffer push functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_typed_push_back_with_null);
+    RUN_TEST(check_ring_buffer_typed_push_back_when_full);
+    RUN_TEST(check_ring_buffer_typed_push_back_with_wrap_data);
+    RUN_TEST(check_ring_buffer_typed_push_front_with_null);
+    RUN_TEST(check_ring_buffer_typed_push_front_when_full);
+    RUN_TEST(check_ring_buffer_typed_push_front_with_wrap_data);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_typed_pop Run test for typed ring buffer pop functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_typed_pop_front_with_null);
+    RUN_TEST(check_ring_buffer_typed_pop_front_when_empty);
+    RUN_TEST(check_ring_buffer_typed_pop_front_with_wrap_data);
+    RUN_TEST(check_ring_buffer_typed_pop_back_with_null);
+    RUN_TEST(check_ring_buffer_typed_pop_back_when_empty);
+    RUN_TEST(check_ring_buffer_typed_pop_back_with_wrap_data);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_typed_access Run test for typed ring buffer access functions
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_typed_front_and_back);
+    RUN_TEST(check_ring_buffer_typed_peek);
+    RUN_TEST(check_ring_buffer_typed_clear);
+
+    /*! @} */
+
+    UNITY_END();
+}
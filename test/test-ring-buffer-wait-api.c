@@ -0,0 +1,224 @@
+/*!
+ * \file test-ring-buffer-wait-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain@studenti.unitn.it]
+ * \authors Dorijan Di Zepp [dorijan.dizepp@eagletrt.it]
+ *
+ * \brief Tests for the blocking push and pop functions
+ *
+ * \details The tests are run only if RING_BUFFER_WAIT is defined at compile time
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include "unity.h"
+#include "ring-buffer-wait-api.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef RING_BUFFER_WAIT
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static int cs_enter_count;
+
+RingBufferHandler_t u32_buf;
+ArenaAllocatorHandler_t arena;
+
+static void cs_enter(void) {
+    pthread_mutex_lock(&mutex);
+    ++cs_enter_count;
+}
+
+static void cs_exit(void) {
+    pthread_mutex_unlock(&mutex);
+}
+
+static double elapsed_ms(const struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double)(end.tv_sec - start->tv_sec) * 1e3 + (double)(end.tv_nsec - start->tv_nsec) * 1e-6;
+}
+
+static int get_cs_enter_count(bool reset) {
+    pthread_mutex_lock(&mutex);
+    const int count = cs_enter_count;
+    if (reset)
+        cs_enter_count = 0;
+    pthread_mutex_unlock(&mutex);
+    return count;
+}
+
+#endif // RING_BUFFER_WAIT
+
+void setUp(void) {
+#ifdef RING_BUFFER_WAIT
+    arena_allocator_api_init(&arena);
+    ring_buffer_api_init(&u32_buf, sizeof(uint32_t), 4, cs_enter, cs_exit, &arena);
+#endif // RING_BUFFER_WAIT
+}
+
+void tearDown(void) {
+#ifdef RING_BUFFER_WAIT
+    arena_allocator_api_free(&arena);
+#endif // RING_BUFFER_WAIT
+}
+
+#ifdef RING_BUFFER_WAIT
+
+/*!
+ * \defgroup ring_buffer_pop_front_wait Test ring buffer blocking pop front function
+ * @{
+ */
+
+static void *delayed_push(void *arg) {
+    uint32_t val = 42;
+    usleep(20000);
+    ring_buffer_api_push_back((RingBufferHandler_t *)arg, &val);
+    return NULL;
+}
+
+static void *blocking_pop(void *arg) {
+    uint32_t out;
+    ring_buffer_api_pop_front_wait((RingBufferHandler_t *)arg, &out, 5000);
+    return NULL;
+}
+
+void check_ring_buffer_pop_front_wait_with_null(void) {
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_pop_front_wait(NULL, NULL, 0));
+}
+void check_ring_buffer_pop_front_wait_not_empty(void) {
+    uint32_t val = 42, out = 0;
+    ring_buffer_api_push_back(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_pop_front_wait(&u32_buf, &out, -1));
+    TEST_ASSERT_EQUAL_UINT32(42U, out);
+}
+void check_ring_buffer_pop_front_wait_zero_timeout(void) {
+    uint32_t out;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_pop_front_wait(&u32_buf, &out, 0));
+}
+void check_ring_buffer_pop_front_wait_timeout(void) {
+    uint32_t out;
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_EMPTY, ring_buffer_api_pop_front_wait(&u32_buf, &out, 30));
+    TEST_ASSERT_GREATER_OR_EQUAL(29.0, elapsed_ms(&start));
+    TEST_ASSERT_EQUAL_UINT32(0U, atomic_load(&u32_buf.items_waiters));
+}
+void check_ring_buffer_pop_front_wait_woken_up(void) {
+    uint32_t out = 0;
+    pthread_t producer;
+    pthread_create(&producer, NULL, delayed_push, &u32_buf);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_pop_front_wait(&u32_buf, &out, 5000));
+    pthread_join(producer, NULL);
+    TEST_ASSERT_EQUAL_UINT32(42U, out);
+    TEST_ASSERT_EQUAL_UINT32(0U, atomic_load(&u32_buf.items_waiters));
+}
+void check_ring_buffer_pop_front_wait_no_wake_without_waiters(void) {
+    uint32_t val = 42;
+    ring_buffer_api_push_back(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_UINT32(0U, atomic_load(&u32_buf.items_futex));
+}
+
+void check_ring_buffer_pop_front_wait_wakes_one_per_item(void) {
+    pthread_t consumers[3];
+    for (size_t i = 0; i < 3; ++i)
+        pthread_create(&consumers[i], NULL, blocking_pop, &u32_buf);
+    while (atomic_load(&u32_buf.items_waiters) < 3U)
+        usleep(1000);
+    usleep(20000);
+
+    // Only the woken consumer retries the pop after the push
+    uint32_t val = 42;
+    get_cs_enter_count(true);
+    ring_buffer_api_push_back(&u32_buf, &val);
+    usleep(20000);
+    TEST_ASSERT_EQUAL_INT(2, get_cs_enter_count(false));
+    TEST_ASSERT_EQUAL_UINT32(2U, atomic_load(&u32_buf.items_waiters));
+
+    uint32_t vals[2] = { 1, 2 };
+    ring_buffer_api_push_back_n(&u32_buf, vals, 2);
+    for (size_t i = 0; i < 3; ++i)
+        pthread_join(consumers[i], NULL);
+    TEST_ASSERT_TRUE(ring_buffer_api_is_empty(&u32_buf));
+    TEST_ASSERT_EQUAL_UINT32(0U, atomic_load(&u32_buf.items_waiters));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup ring_buffer_push_back_wait Test ring buffer blocking push back function
+ * @{
+ */
+
+static void *delayed_pop(void *arg) {
+    uint32_t val;
+    usleep(20000);
+    ring_buffer_api_pop_front((RingBufferHandler_t *)arg, &val);
+    return NULL;
+}
+
+void check_ring_buffer_push_back_wait_with_null(void) {
+    uint32_t val = 42;
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_push_back_wait(NULL, &val, 0));
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_NULL_POINTER, ring_buffer_api_push_back_wait(&u32_buf, NULL, 0));
+}
+void check_ring_buffer_push_back_wait_timeout(void) {
+    uint32_t val = 42;
+    for (size_t i = 0; i < u32_buf.capacity; ++i)
+        ring_buffer_api_push_back(&u32_buf, &val);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_FULL, ring_buffer_api_push_back_wait(&u32_buf, &val, 10));
+}
+void check_ring_buffer_push_back_wait_woken_up(void) {
+    uint32_t val = 42;
+    for (size_t i = 0; i < u32_buf.capacity; ++i)
+        ring_buffer_api_push_back(&u32_buf, &val);
+
+    pthread_t consumer;
+    pthread_create(&consumer, NULL, delayed_pop, &u32_buf);
+    TEST_ASSERT_EQUAL_INT(RING_BUFFER_OK, ring_buffer_api_push_back_wait(&u32_buf, &val, 5000));
+    pthread_join(consumer, NULL);
+    TEST_ASSERT_TRUE(ring_buffer_api_is_full(&u32_buf));
+}
+
+/*! @} */
+
+#endif // RING_BUFFER_WAIT
+
+int main() {
+    UNITY_BEGIN();
+
+#ifdef RING_BUFFER_WAIT
+    /*!
+     * \addtogroup ring_buffer_pop_front_wait Run test for ring buffer blocking pop front function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_pop_front_wait_with_null);
+    RUN_TEST(check_ring_buffer_pop_front_wait_not_empty);
+    RUN_TEST(check_ring_buffer_pop_front_wait_zero_timeout);
+    RUN_TEST(check_ring_buffer_pop_front_wait_timeout);
+    RUN_TEST(check_ring_buffer_pop_front_wait_woken_up);
+    RUN_TEST(check_ring_buffer_pop_front_wait_no_wake_without_waiters);
+    RUN_TEST(check_ring_buffer_pop_front_wait_wakes_one_per_item);
+
+    /*! @} */
+
+    /*!
+     * \addtogroup ring_buffer_push_back_wait Run test for ring buffer blocking push back function
+     * @{
+     */
+
+    RUN_TEST(check_ring_buffer_push_back_wait_with_null);
+    RUN_TEST(check_ring_buffer_push_back_wait_timeout);
+    RUN_TEST(check_ring_buffer_push_back_wait_woken_up);
+
+    /*! @} */
+#endif // RING_BUFFER_WAIT
+
+    UNITY_END();
+}